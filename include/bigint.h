@@ -35,6 +35,39 @@
 #include <vector>
 #include <cmath>
 #include <limits>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <future>
+#include <atomic>
+#include <random>
+#include <algorithm>
+#include <numeric>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <charconv>
+#include <system_error>
+#include <cstring>
+#include <cctype>
+#include <type_traits>
+#if __cplusplus >= 202002L && defined(__cpp_impl_three_way_comparison)
+#include <compare>
+#define BIGINT_THREE_WAY 1
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define BIGINT_POSIX_MMAP 1
+#else
+#include <fstream>
+#endif
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define BIGINT_X86_SIMD 1
+#endif
 
 // Macros for Programmer(User) use cases.
 
@@ -52,14 +85,57 @@
 #define big_reverse bigint::_big_reverse
 #define big_gcd bigint::_big_gcd
 #define big_lcm bigint::_big_lcm
+#define big_divexact bigint::_big_divexact
 #define big_fact bigint::_big_fact
+#define big_productRange bigint::_big_productRange
+#define big_fib bigint::_big_fib
+#define big_lucas bigint::_big_lucas
+#define big_binomial bigint::_big_binomial
+#define big_setThreads bigint::_big_setThreads
 #define big_isPrime bigint::_big_isPrime
+#define big_powmod bigint::_big_powmod
+#define big_trialDivide bigint::_big_trialDivide
+#define big_factor bigint::_big_factor
+#define big_nextPrime bigint::_big_nextPrime
+#define big_prevPrime bigint::_big_prevPrime
+#define big_primeRange bigint::_big_primeRange
+#define big_crt bigint::_big_crt
+#define big_jacobi bigint::_big_jacobi
+#define big_legendre bigint::_big_legendre
+#define big_kronecker bigint::_big_kronecker
+#define big_sqrtmod bigint::_big_sqrtmod
+#define big_sort bigint::_big_sort
+#define big_parallelSort bigint::_big_parallelSort
+#define big_nth_element bigint::_big_nth_element
+#define big_minmax bigint::_big_minmax
 #define big_isPalindrome bigint::_big_isPalindrome
 #define to_bigint bigint::_to_bigint
 
 // Big Integer Class
 
 class bigint {
+    public:
+        // Effort budgets for big_factor, a stage with a zero budget is skipped.
+        struct factorOptions {
+            unsigned long long trialBound = 65536;          // trial division by primes up to this bound
+            unsigned long long rhoIterations = 100000;      // Pollard rho (Brent) iterations per cofactor
+            unsigned long long pm1B1 = 50000;               // Pollard p-1 stage 1 bound
+            unsigned long long pm1B2 = 5000000;             // Pollard p-1 stage 2 bound
+            unsigned int ecmCurves = 80;                    // ECM curves per cofactor
+            unsigned long long ecmB1 = 11000;               // ECM stage 1 bound
+            unsigned long long ecmB2 = 1100000;             // ECM stage 2 bound
+        };
+        // Byte order for export_bytes / import_bytes: big puts the most significant word first and
+        // the most significant byte first within each word, little the reverse.
+        enum class byteOrder { little, big, native };
+        class primeRange;
+        class crtBasis;
+        class rnsBasis;
+        class rnsInt;
+        class view;
+        class mappedFile;
+        class hashKey;
+
     private: 
         std::string str; // only data memeber for strong Big Integer as String. [For signed int, str[0] = '-']
         
@@ -74,13 +150,186 @@ class bigint {
 
         static std::string mod(std::string, std::string);
         static std::string shortDivide(std::string, unsigned long long int);
-        static std::string maximum(std::string, std::string);
-        static bool is_maximum(std::string, std::string);
-        static bool is_strictlyMaximum(std::string, std::string);
-        static std::string minimum(std::string, std::string);
-        static bool is_minimum(std::string, std::string);
-        static bool is_strictlyMinimum(std::string, std::string);
-        static bool is_bigint(std::string);
+        static int compareDecimal(const std::string&, const std::string&);
+        static int compareMagnitude(const std::string&, bool, unsigned __int128);
+        static int signDecimal(const std::string&);
+        static std::vector<size_t> sortPermutation(const std::vector<const std::string*>&);
+        static const size_t SORT_RADIX_THRESHOLD = 64;
+        template<class T> struct isPrimitive : std::integral_constant<bool,      // any integer but bool, 128 bit too under strict -std
+            (std::is_integral<T>::value && !std::is_same<T, bool>::value) ||
+            std::is_same<T, __int128>::value || std::is_same<T, unsigned __int128>::value> {};
+        template<class T> static int compareSmall(const std::string& s, T v) {   // s against a primitive, by sign and value
+            bool negative = v < T(0);
+            unsigned __int128 magnitude = (unsigned __int128)v;
+            return compareMagnitude(s, negative, negative ? (unsigned __int128)0 - magnitude : magnitude);
+        }
+        static std::string maximum(const std::string&, const std::string&);
+        static bool is_maximum(const std::string&, const std::string&);
+        static bool is_strictlyMaximum(const std::string&, const std::string&);
+        static std::string minimum(const std::string&, const std::string&);
+        static bool is_minimum(const std::string&, const std::string&);
+        static bool is_strictlyMinimum(const std::string&, const std::string&);
+        static bool is_bigint(const std::string&);
+        static std::string divexact(std::string, std::string);
+
+        // Decimal text: digit validation 32/16/8 characters per step (AVX2, SSE2 or SWAR picked at
+        // run time) and 8 digit SWAR parsing
+        static bool allDigits(const char*, size_t);
+        static bool allDigitsScalar(const char*, size_t);
+#ifdef BIGINT_X86_SIMD
+        static bool allDigitsSSE2(const char*, size_t);
+        __attribute__((target("avx2"))) static bool allDigitsAVX2(const char*, size_t);
+#endif
+        static std::uint32_t parseEightDigits(const char*);
+
+        // Limb kernels: magnitudes in base 10^9, least significant limb first.
+
+        using limbs = std::vector<std::uint32_t>;
+        static const std::uint32_t LIMB_BASE = 1000000000;
+        static const int LIMB_DIGITS = 9;
+        static const size_t KARATSUBA_THRESHOLD = 40;
+        static const size_t NTT_THRESHOLD = 1500;
+        static const size_t NTT_MAX_LENGTH = (size_t)1 << 23;
+
+        static limbs toLimbs(const std::string&);
+        static std::string fromLimbs(const limbs&, bool);
+        static void trimLimbs(limbs&);
+        static void mulLimbsSmall(limbs&, std::uint32_t);
+        static std::uint32_t divLimbsSmall(limbs&, std::uint32_t);
+        static size_t removeTwos(limbs&);
+        static limbs divexactLimbs(limbs, limbs);
+        static limbs limbsFromU64(std::uint64_t);
+        static int compareLimbs(const limbs&, const limbs&);
+        static void addLimbsAt(limbs&, const limbs&, size_t);
+        static void subLimbs(limbs&, const limbs&);
+        static limbs mulLimbs(const limbs&, const limbs&, unsigned int = 1);
+        static limbs mulSchool(const std::uint32_t*, size_t, const std::uint32_t*, size_t);
+        static limbs mulKaratsuba(const limbs&, const limbs&);
+        static limbs mulNTT(const limbs&, const limbs&, unsigned int, std::uint64_t = LIMB_BASE);
+        static void ntt(std::vector<std::uint32_t>&, bool, std::uint32_t);
+        static std::uint64_t powmodU64(std::uint64_t, std::uint64_t, std::uint64_t);
+        static void divmodLimbs(const limbs&, const limbs&, limbs&, limbs&);
+        static limbs modLimbs(const limbs&, const limbs&);
+        static bool limbsToU64(const limbs&, std::uint64_t&);
+        static std::vector<unsigned char> limbsToBits(limbs);
+        static limbs powmodLimbs(const limbs&, const std::vector<unsigned char>&, size_t, const limbs&);
+        static limbs isqrtLimbs(const limbs&);
+        static std::uint32_t inverseModBase(std::uint32_t);
+        static limbs gcdLimbs(limbs, limbs);
+        static limbs invmodLimbs(const limbs&, const limbs&, limbs&);
+
+        // Binary words: magnitudes in base 2^32, least significant word first, converted to and from limbs by divide and conquer
+        typedef std::vector<std::uint32_t> words;
+        static const size_t RADIX_BLOCK = 32;
+        static const size_t WORD_NTT_THRESHOLD = 96;
+        static void mulWordsSmall(words&, std::uint32_t, std::uint32_t);
+        static void addWordsAt(words&, const words&, size_t);
+        static words mulWords(const words&, const words&, unsigned int = 1);
+        static words limbsToWords(const limbs&, unsigned int = 1);
+        static words limbsToWordsRange(const std::uint32_t*, size_t, const std::vector<words>&, size_t, unsigned int);
+        static size_t bitLengthWords(const words&);
+        static limbs wordsToLimbs(const words&, unsigned int = 1);
+        static limbs wordsToLimbsRange(const std::uint32_t*, size_t, const std::vector<limbs>&, size_t, unsigned int);
+
+        // Bitwise kernels: two's complement semantics over sign and magnitude, on words
+        static void negateWords(words&);
+        static void decrementWords(words&);
+        static std::uint32_t lowNineBits(const std::string&);
+        static std::string bitwise(const std::string&, const std::string&, char);
+        static std::string shiftLeft(const std::string&, long long);
+        static std::string shiftRight(const std::string&, long long);
+
+        // Floating point conversion: 128 bit bounds on the value, exact words only when they round apart
+        static unsigned __int128 mulTop(unsigned __int128, unsigned __int128, bool, long long&);
+        template<class T> static T toFloating(const std::string&);
+        static std::string fromFloating(long double);
+
+        // Hashing kernels
+        static std::uint64_t mixBits(std::uint64_t);
+        static std::uint64_t mulModMersenne61(std::uint64_t, std::uint64_t);
+
+        // Radix conversion for bases 2 to 36 other than 10, through words
+        static int digitValue(char);
+        static std::uint32_t divWordsSmall(words&, std::uint32_t);
+        static words digitsToWords(const char*, size_t, int);
+        static std::string wordsToDigits(words, int);
+
+        // Montgomery arithmetic modulo an n coprime to 10, residues kept as exactly n.size() limbs
+
+        struct montgomery {
+            limbs n, one, r2;                                   // one = R mod n, r2 = R^2 mod n, R = 10^(9k)
+            size_t k;
+            std::uint64_t ninv;                                 // -n^-1 mod 10^9
+            explicit montgomery(const limbs&);
+            void mul(const limbs&, const limbs&, limbs&) const; // out = a*b/R mod n, out may alias a or b
+            limbs mul(const limbs& a, const limbs& b) const { limbs r; mul(a, b, r); return r; }
+            void add(limbs&, const limbs&) const;
+            void sub(limbs&, const limbs&) const;
+            limbs to(const limbs&) const;
+            limbs from(const limbs&) const;
+            bool isZero(const limbs&) const;
+        };
+        static limbs powmodMont(const montgomery&, const limbs&, const std::vector<unsigned char>&, size_t);
+        static limbs powmodMontU64(const montgomery&, const limbs&, std::uint64_t);
+
+        // Primality (BPSW: strong base-2 Miller-Rabin + strong Lucas)
+
+        static bool isPrimeU64(std::uint64_t);
+        static int jacobiU64(std::uint64_t, std::uint64_t);
+        static bool millerRabinLimbs(const limbs&, const limbs&);
+        static bool strongLucasLimbs(const limbs&);
+        static bool isProbablePrime(const limbs&, int);
+
+        // Quadratic residues: Jacobi symbol by the binary algorithm, square roots modulo a prime
+
+        static limbs reduceSigned(const std::string&, const limbs&);
+        static int jacobiLimbs(limbs, limbs);
+        static bool maybeSquare(const limbs&);
+        static limbs sqrtmodLimbs(const limbs&, const limbs&);
+
+        // Small-prime table: the primes below 2^16, grouped into products that fit a 32 bit word
+
+        static const std::uint32_t SMALL_PRIME_LIMIT = 65536;
+        struct primeGroup {
+            std::uint32_t product;
+            size_t first, last;                                 // indices into smallPrimes()
+        };
+        static const std::vector<std::uint32_t>& smallPrimes();
+        static const std::vector<primeGroup>& smallPrimeGroups();
+        static const limbs& smallPrimorial();
+        static std::uint64_t trialDivideLimbs(const limbs&, std::uint64_t);
+        template<class F> static std::uint64_t findLargePrime(std::uint64_t, F);
+
+        // Factorization stages, every cofactor handed to them is coprime to 10
+
+        static void stripSmallFactors(limbs&, std::uint64_t, std::vector<limbs>&);
+        static std::uint64_t pollardRhoU64(std::uint64_t);
+        static limbs pollardRho(const limbs&, std::uint64_t);
+        static limbs pollardPm1(const limbs&, std::uint64_t, std::uint64_t);
+        static limbs ecm(const limbs&, unsigned int, std::uint64_t, std::uint64_t);
+        static void factorU64(std::uint64_t, std::vector<limbs>&);
+        static void factorLimbs(const limbs&, const factorOptions&, std::vector<limbs>&);
+
+        // Prime search: windows [base, base + width) sieved by the small primes, survivors confirmed by BPSW
+
+        static size_t primeWindow(const limbs&);
+        static void sieveWindow(const limbs&, size_t, std::vector<char>&);
+        static bool isSievedPrime(const limbs&);
+        static limbs nextPrimeLimbs(const limbs&);
+        static limbs prevPrimeLimbs(const limbs&);
+
+        // Factorial engine (prime swing over a product tree), split over threadCount() workers
+
+        static std::atomic<unsigned int>& threadCount();
+        static std::vector<std::uint32_t> sievePrimes(std::uint32_t);
+        static limbs productTree(const std::vector<std::uint32_t>&, size_t, size_t, unsigned int = 1);
+        static limbs swingLimbs(std::uint32_t, const std::vector<std::uint32_t>&, unsigned int);
+        static limbs factLimbs(std::uint32_t, const std::vector<std::uint32_t>&, unsigned int);
+        static std::string productRange(std::string, std::string);
+        static std::uint32_t smallArgument(std::string, const char*);
+        static void fibLimbs(std::uint32_t, limbs&, limbs&, unsigned int);
+        static limbs binomialLimbs(std::uint32_t, std::uint32_t, unsigned int);
+        static const std::uint32_t BINOMIAL_DIRECT_K = 2048;
 
         // Public Property
 
@@ -97,8 +346,19 @@ class bigint {
         static std::string gcd(std::string, std::string);
         static std::string lcm(std::string, std::string);
         static std::string fact(std::string);
+        static std::string fib(std::string);
+        static std::string lucas(std::string);
+        static std::string binomial(std::string, std::string);
         static bool isPalindrome(std::string);
-        static bool isPrime(std::string);   
+        static bool isPrime(std::string, int = 0);
+        static std::string powmod(std::string, std::string, std::string);
+        static int jacobi(std::string, std::string);
+        static int kronecker(std::string, std::string);
+        static std::string sqrtmod(std::string, std::string);
+        static unsigned long long trialDivide(std::string, unsigned long long);
+        static std::vector<std::string> factor(std::string, const factorOptions&);
+        static std::string nextPrime(std::string);
+        static std::string prevPrime(std::string);
 
 
     public: 
@@ -109,7 +369,13 @@ class bigint {
         bigint(std::string s) {
             if(!is_bigint(s))
                 throw std::runtime_error("Invalid Big Integer has been fed.");   // if the input string is not valid number.
-            str = s;
+            str = std::move(s);
+        }
+        bigint(std::string const &s, int base) {          // s in a base from 2 to 36, letters in either case
+            str = '0';
+            std::from_chars_result r = from_chars(s.data(), s.data() + s.length(), *this, base);
+            if(r.ec != std::errc() || r.ptr != s.data() + s.length())
+                throw std::runtime_error("Invalid Big Integer has been fed.");
         }
         bigint(long long int n) {
             str = std::to_string(n);
@@ -120,26 +386,75 @@ class bigint {
         bigint(long int n) {
             str = std::to_string(n);
         }
+        explicit bigint(double d) {                       // truncated toward zero; NaN and infinity throw
+            str = fromFloating(d);
+        }
+        explicit bigint(long double d) {
+            str = fromFloating(d);
+        }
         bigint(const bigint &n) {
             str = n.str;
         }
+        bigint(bigint &&n) noexcept : str(std::move(n.str)) {}
+        bigint& operator = (const bigint&) = default;
+        bigint& operator = (bigint&&) noexcept = default;
+        bigint(view const &v);                            // the value of a serialized record, so views work as operands
 
-        // operator overloading for output stream {<<}
+        // operator overloading for output stream {<<}, honouring std::hex / std::oct, showbase and uppercase
         friend std::ostream &operator << (std::ostream& stream, const bigint &n) {
-            stream << n.str;
+            std::ios_base::fmtflags flags = stream.flags();
+            int base = (flags & std::ios_base::hex) ? 16 : (flags & std::ios_base::oct) ? 8 : 10;
+            if(base == 10) {
+                stream << n.str;
+                return stream;
+            }
+            std::string s = n.to_string(base);
+            size_t digits = s[0] == '-' ? 1 : 0;
+            if((flags & std::ios_base::uppercase) && base == 16)
+                std::transform(s.begin(), s.end(), s.begin(), [](char c) { return (char)std::toupper((unsigned char)c); });
+            if((flags & std::ios_base::showbase) && s.compare(digits, std::string::npos, "0") != 0)
+                s.insert(digits, base == 8 ? "0" : (flags & std::ios_base::uppercase) ? "0X" : "0x");
+            stream << s;
             return stream;
         }
 
+        // text without a stream, in the manner of <charconv>: errors are reported, never thrown
+        std::string to_string(int base = 10) const {      // digits in a base from 2 to 36, lowercase letters
+            if(base == 10)
+                return str;
+            std::string s(digits_required(base), '\0');
+            std::to_chars_result r = to_chars(&s[0], &s[0] + s.length(), base);
+            if(r.ec != std::errc())
+                throw std::invalid_argument("Base must be in the range 2 to 36.");
+            s.resize(r.ptr - &s[0]);
+            return s;
+        }
+        std::to_chars_result to_chars(char *first, char *last, int base = 10) const;    // digits in [first, last), no terminator
+        static std::from_chars_result from_chars(const char *first, const char *last, bigint &value, int base = 10);
+        size_t digits_required(int base = 10) const;     // an upper bound on the characters to_chars writes, sign included
+
+        // raw magnitude as word_size byte words, in the manner of mpz_export / mpz_import; the sign is not stored
+        std::vector<unsigned char> export_bytes(byteOrder order = byteOrder::little, size_t word_size = 1) const;
+        static bigint import_bytes(const void *data, size_t count, byteOrder order = byteOrder::little, size_t word_size = 1);
+
+        // compact self-describing record: varint (word count * 2 + sign), then little endian 32 bit words
+        std::vector<unsigned char> serialize() const;
+        static bigint deserialize(const unsigned char *&first, const unsigned char *last);
+    private:
+        static const unsigned char* recordHeader(const unsigned char*, const unsigned char*, std::uint64_t&, bool&);
+        static byteOrder nativeByteOrder();
+        static std::istream& readStream(std::istream&, bigint&);
+    public:
+
         // operator overloading for input stream {>>}
         friend std::istream &operator >> (std::istream& stream, bigint &n) {
-            stream >> n.str;
-            return stream;
+            return readStream(stream, n);
         }
 
         /* Operator {+} Overloadings, for different kind of 
         parameter for the programmer's convinience  */
 
-        bigint operator + (bigint const &n) {
+        bigint operator + (bigint const &n) const {
             bigint ans;
             ans.str = add(str, n.str);
             return ans;
@@ -177,7 +492,7 @@ class bigint {
 
         // Extra shortcut feature
 
-        bigint& operator += (bigint const n) {
+        bigint& operator += (bigint const &n) {
             (*this).str = add((*this).str, n.str);
             return (*this);
         }
@@ -187,7 +502,7 @@ class bigint {
         /* Operator {-} Overloadings, for different kind of 
         parameter for the programmer's convinience  */
 
-        bigint operator - (bigint const &n) {
+        bigint operator - (bigint const &n) const {
             bigint ans;
             ans.str = subtract(str, n.str);
             return ans;
@@ -226,7 +541,7 @@ class bigint {
 
         // Extra shortcut feature
 
-        bigint& operator -= (bigint const n) {
+        bigint& operator -= (bigint const &n) {
             (*this).str = subtract((*this).str, n.str);
             return (*this);
         }
@@ -234,7 +549,7 @@ class bigint {
         /* Operator {*} Overloadings, for different kind of 
         parameter for the programmer's convinience  */
 
-        bigint operator * (bigint const &n) {
+        bigint operator * (bigint const &n) const {
             bigint ans;
             ans.str = multiply(str, n.str);
             return ans;
@@ -271,7 +586,7 @@ class bigint {
         }
         // Extra shortcut feature
 
-        bigint& operator *= (bigint const n) {
+        bigint& operator *= (bigint const &n) {
             (*this).str = multiply((*this).str, n.str);
             return (*this);
         }
@@ -279,7 +594,7 @@ class bigint {
         /* Operator {/} Overloadings, for different kind of 
         parameter for the programmer's convinience  */
 
-        bigint operator / (bigint const &n) {
+        bigint operator / (bigint const &n) const {
             bigint ans;
             ans.str = divide(str, n.str);
             return ans;
@@ -317,7 +632,7 @@ class bigint {
 
         // Extra shortcut feature
 
-        bigint& operator /= (bigint const n) {
+        bigint& operator /= (bigint const &n) {
             (*this).str = divide((*this).str, n.str);
             return (*this);
         }
@@ -325,7 +640,7 @@ class bigint {
         /* Operator {%} Overloadings, for different kind of 
         parameter for the programmer's convinience  */
 
-        bigint operator % (bigint const &n) {
+        bigint operator % (bigint const &n) const {
             bigint ans;
             ans.str = mod(str, n.str);
             return ans;
@@ -363,11 +678,68 @@ class bigint {
         
         // Extra shortcut feature
         
-        bigint& operator %= (bigint const n) {
+        bigint& operator %= (bigint const &n) {
             (*this).str = mod((*this).str, n.str);
             return (*this);
         }
 
+        /* Bitwise Operators {&, |, ^, ~} and Shifts {<<, >>}, with the semantics of an infinitely
+        sign extended two's complement: ~x == -x - 1, x >> k == floor(x / 2^k) */
+
+        friend bigint operator & (bigint const &n1, bigint const &n2) {
+            bigint ans;
+            ans.str = bitwise(n1.str, n2.str, '&');
+            return ans;
+        }
+        friend bigint operator | (bigint const &n1, bigint const &n2) {
+            bigint ans;
+            ans.str = bitwise(n1.str, n2.str, '|');
+            return ans;
+        }
+        friend bigint operator ^ (bigint const &n1, bigint const &n2) {
+            bigint ans;
+            ans.str = bitwise(n1.str, n2.str, '^');
+            return ans;
+        }
+        bigint operator ~ () const {
+            bigint ans;
+            ans.str = subtract("-1", str);
+            return ans;
+        }
+        bigint operator << (long long k) const {          // throws std::invalid_argument if k < 0
+            bigint ans;
+            ans.str = shiftLeft(str, k);
+            return ans;
+        }
+        bigint operator >> (long long k) const {          // rounds toward negative infinity
+            bigint ans;
+            ans.str = shiftRight(str, k);
+            return ans;
+        }
+
+        // Extra shortcut feature
+
+        bigint& operator &= (bigint const &n) {
+            (*this).str = bitwise((*this).str, n.str, '&');
+            return (*this);
+        }
+        bigint& operator |= (bigint const &n) {
+            (*this).str = bitwise((*this).str, n.str, '|');
+            return (*this);
+        }
+        bigint& operator ^= (bigint const &n) {
+            (*this).str = bitwise((*this).str, n.str, '^');
+            return (*this);
+        }
+        bigint& operator <<= (long long k) {
+            (*this).str = shiftLeft((*this).str, k);
+            return (*this);
+        }
+        bigint& operator >>= (long long k) {
+            (*this).str = shiftRight((*this).str, k);
+            return (*this);
+        }
+
         //-------------------------------------------------
         //------------Increment and Decrement--------------
         //-------------------------------------------------
@@ -406,170 +778,156 @@ class bigint {
         /* Operator {>} Overloadings, for different kind of 
         parameter for the programmer's convinience  */
 
-        bool operator > (bigint const &n) {
-            return is_strictlyMaximum(str, n.str);
-        }
-        friend bool operator > (bigint const &n1, int n2) {
-            return is_strictlyMaximum(n1.str, std::to_string(n2));
-        }
-        friend bool operator > (int n1, bigint const &n2) {
-            return is_strictlyMaximum(std::to_string(n1), n2.str);
-        }
-        friend bool operator > (bigint const &n1, long int n2) {
-            return is_strictlyMaximum(n1.str, std::to_string(n2));
+        bool operator > (bigint const &n) const {
+            return compareDecimal(str, n.str) > 0;
         }
-        friend bool operator > (long int n1, bigint const &n2) {
-            return is_strictlyMaximum(std::to_string(n1), n2.str);
+        template<class T, class = typename std::enable_if<isPrimitive<T>::value>::type>
+        friend bool operator > (bigint const &n1, T n2) {
+            return compareSmall(n1.str, n2) > 0;
         }
-        friend bool operator > (bigint const &n1, long long int n2) {
-            return is_strictlyMaximum(n1.str, std::to_string(n2));
-        }
-        friend bool operator > (long long int n1, bigint const &n2) {
-            return is_strictlyMaximum(std::to_string(n1), n2.str);
+        template<class T, class = typename std::enable_if<isPrimitive<T>::value>::type>
+        friend bool operator > (T n1, bigint const &n2) {
+            return compareSmall(n2.str, n1) < 0;
         }
 
         /* Operator {<} Overloadings, for different kind of 
         parameter for the programmer's convinience  */
 
-        bool operator < (bigint const &n) {
-            return is_strictlyMinimum(str, n.str);
-        }
-        friend bool operator < (bigint const &n1, int n2) {
-            return is_strictlyMinimum(n1.str, std::to_string(n2));
-        }
-        friend bool operator < (int n1, bigint const &n2) {
-            return is_strictlyMinimum(std::to_string(n1), n2.str);
-        }
-        friend bool operator < (bigint const &n1, long int n2) {
-            return is_strictlyMinimum(n1.str, std::to_string(n2));
+        bool operator < (bigint const &n) const {
+            return compareDecimal(str, n.str) < 0;
         }
-        friend bool operator < (long int n1, bigint const &n2) {
-            return is_strictlyMinimum(std::to_string(n1), n2.str);
+        template<class T, class = typename std::enable_if<isPrimitive<T>::value>::type>
+        friend bool operator < (bigint const &n1, T n2) {
+            return compareSmall(n1.str, n2) < 0;
         }
-        friend bool operator < (bigint const &n1, long long int n2) {
-            return is_strictlyMinimum(n1.str, std::to_string(n2));
-        }
-        friend bool operator < (long long int n1, bigint const &n2) {
-            return is_strictlyMinimum(std::to_string(n1), n2.str);
+        template<class T, class = typename std::enable_if<isPrimitive<T>::value>::type>
+        friend bool operator < (T n1, bigint const &n2) {
+            return compareSmall(n2.str, n1) > 0;
         }
 
         /* Operator {>=} Overloadings, for different kind of 
         parameter for the programmer's convinience  */
 
-        bool operator >= (bigint const &n) {
-            return is_maximum(str, n.str);
-        }
-        friend bool operator >= (bigint const &n1, int n2) {
-            return is_maximum(n1.str, std::to_string(n2));
-        }
-        friend bool operator >= (int n1, bigint const &n2) {
-            return is_maximum(std::to_string(n1), n2.str);
-        }
-        friend bool operator >= (bigint const &n1, long int n2) {
-            return is_maximum(n1.str, std::to_string(n2));
+        bool operator >= (bigint const &n) const {
+            return compareDecimal(str, n.str) >= 0;
         }
-        friend bool operator >= (long int n1, bigint const &n2) {
-            return is_maximum(std::to_string(n1), n2.str);
+        template<class T, class = typename std::enable_if<isPrimitive<T>::value>::type>
+        friend bool operator >= (bigint const &n1, T n2) {
+            return compareSmall(n1.str, n2) >= 0;
         }
-        friend bool operator >= (bigint const &n1, long long int n2) {
-            return is_maximum(n1.str, std::to_string(n2));
-        }
-        friend bool operator >= (long long int n1, bigint const &n2) {
-            return is_maximum(std::to_string(n1), n2.str);
+        template<class T, class = typename std::enable_if<isPrimitive<T>::value>::type>
+        friend bool operator >= (T n1, bigint const &n2) {
+            return compareSmall(n2.str, n1) <= 0;
         }
 
         /* Operator {<=} Overloadings, for different kind of 
         parameter for the programmer's convinience  */
 
-        bool operator <= (bigint const &n) {
-            return is_minimum(str, n.str);
-        }
-        friend bool operator <= (bigint const &n1, int n2) {
-            return is_minimum(n1.str, std::to_string(n2));
-        }
-        friend bool operator <= (int n1, bigint const &n2) {
-            return is_minimum(std::to_string(n1), n2.str);
-        }
-        friend bool operator <= (bigint const &n1, long int n2) {
-            return is_minimum(n1.str, std::to_string(n2));
+        bool operator <= (bigint const &n) const {
+            return compareDecimal(str, n.str) <= 0;
         }
-        friend bool operator <= (long int n1, bigint const &n2) {
-            return is_minimum(std::to_string(n1), n2.str);
+        template<class T, class = typename std::enable_if<isPrimitive<T>::value>::type>
+        friend bool operator <= (bigint const &n1, T n2) {
+            return compareSmall(n1.str, n2) <= 0;
         }
-        friend bool operator <= (bigint const &n1, long long int n2) {
-            return is_minimum(n1.str, std::to_string(n2));
-        }
-        friend bool operator <= (long long int n1, bigint const &n2) {
-            return is_minimum(std::to_string(n1), n2.str);
+        template<class T, class = typename std::enable_if<isPrimitive<T>::value>::type>
+        friend bool operator <= (T n1, bigint const &n2) {
+            return compareSmall(n2.str, n1) >= 0;
         }
 
 
         /* Operator {==} Overloadings, for different kind of 
         parameter for the programmer's convinience  */
 
-        bool operator ==(bigint const &n) {
-            return (*this).str == n.str;
-        }
-        friend bool operator == (bigint const &n1, int n2) {
-            return n1.str == std::to_string(n2);
-        }
-        friend bool operator == (int n1, bigint const &n2) {
-            return std::to_string(n1) == n2.str;
-        }
-        friend bool operator == (bigint const &n1, long int n2) {
-            return n1.str == std::to_string(n2);
+        bool operator ==(bigint const &n) const {
+            return compareDecimal(str, n.str) == 0;
         }
-        friend bool operator == (long int n1, bigint const &n2) {
-            return std::to_string(n1) == n2.str;
+        template<class T, class = typename std::enable_if<isPrimitive<T>::value>::type>
+        friend bool operator == (bigint const &n1, T n2) {
+            return compareSmall(n1.str, n2) == 0;
         }
-        friend bool operator == (bigint const &n1, long long int n2) {
-            return n1.str == std::to_string(n2);
-        }
-        friend bool operator == (long long int n1, bigint const &n2) {
-            return std::to_string(n1) == n2.str;
+        template<class T, class = typename std::enable_if<isPrimitive<T>::value>::type>
+        friend bool operator == (T n1, bigint const &n2) {
+            return compareSmall(n2.str, n1) == 0;
         }
 
 
         /* Operator {!=} Overloadings, for different kind of 
         parameter for the programmer's convinience  */
 
-        bool operator !=(bigint const &n) {
-            return (*this).str != n.str;
+        bool operator !=(bigint const &n) const {
+            return compareDecimal(str, n.str) != 0;
+        }
+        template<class T, class = typename std::enable_if<isPrimitive<T>::value>::type>
+        friend bool operator != (bigint const &n1, T n2) {
+            return compareSmall(n1.str, n2) != 0;
         }
-        friend bool operator != (bigint const &n1, int n2) {
-            return n1.str != std::to_string(n2);
+        template<class T, class = typename std::enable_if<isPrimitive<T>::value>::type>
+        friend bool operator != (T n1, bigint const &n2) {
+            return compareSmall(n2.str, n1) != 0;
         }
-        friend bool operator != (int n1, bigint const &n2) {
-            return std::to_string(n1) != n2.str;
+#ifdef BIGINT_THREE_WAY
+        std::strong_ordering operator <=> (bigint const &n) const {
+            int c = compareDecimal(str, n.str);
+            return c < 0 ? std::strong_ordering::less : c > 0 ? std::strong_ordering::greater : std::strong_ordering::equal;
         }
-        friend bool operator != (bigint const &n1, long int n2) {
-            return n1.str != std::to_string(n2);
+#endif
+        int compare(bigint const &n) const {              // -1, 0 or 1 as *this <, ==, > n, without allocating
+            return compareDecimal(str, n.str);
+        }
+
+        // cheap queries on the digits in place
+        bool is_zero() const {
+            return signDecimal(str) == 0;
         }
-        friend bool operator != (long int n1, bigint const &n2) {
-            return std::to_string(n1) != n2.str;
+        bool is_one() const {
+            return compareMagnitude(str, false, 1) == 0;
         }
-        friend bool operator != (bigint const &n1, long long int n2) {
-            return n1.str != std::to_string(n2);
+        int sign() const {                                 // -1, 0 or 1
+            return signDecimal(str);
         }
-        friend bool operator != (long long int n1, bigint const &n2) {
-            return std::to_string(n1) != n2.str;
+        bool is_even() const {
+            return (str.back() - '0') % 2 == 0;
         }
 
+        // bit queries: lengths and counts are of |x|, single bits follow the two's complement of x
+        static constexpr size_t npos = (size_t)-1;         // no such bit
+        size_t bit_length() const;                         // bits in |x|, 0 for 0
+        size_t popcount() const;                           // 1 bits in |x|
+        bool test_bit(size_t i) const;
+        void set_bit(size_t i);
+        void clear_bit(size_t i);
+        size_t count_trailing_zeros() const;               // npos for 0
+        size_t scan1(size_t from) const;                   // the first 1 bit at or above from, npos if none
+
+        // floating point and checked machine integer conversions
+        double to_double() const;                          // correctly rounded to nearest even, +-inf past the range
+        long double to_long_double() const;
+        bool try_to_int64(std::int64_t &out) const;        // false, with out untouched, when the value does not fit
+
+        // hashing: equal values (leading zeros and "-0" included) hash alike
+        size_t hash() const;                               // what std::hash<bigint> returns
+        std::uint64_t fingerprint() const;                 // the value mod 2^61 - 1, in [0, 2^61 - 1)
+
         //-----------------------------------------------------------
         //--------Function Definitions for External Uses-------------
         //-----------------------------------------------------------
 
         
-        static bigint _big_max(bigint &a, bigint &b) {     // returns the maximum value between two Big Integers.
-            bigint ans;
-            ans.str = maximum(a.str, b.str);
-            return ans;
+        static const bigint& _big_max(bigint const &a, bigint const &b) {   // returns the maximum of two Big Integers, a on ties, no copy.
+            return compareDecimal(a.str, b.str) >= 0 ? a : b;
+        }
+        static const bigint& _big_min(bigint const &a, bigint const &b) {   // returns the minimum of two Big Integers, a on ties, no copy.
+            return compareDecimal(a.str, b.str) <= 0 ? a : b;
+        }
+        template<class It> static void _big_sort(It first, It last);           // sorts a random access range of Big Integers, ascending.
+        template<class It> static void _big_parallelSort(It first, It last);   // same, split over big_setThreads workers.
+        template<class It> static void _big_nth_element(It first, It nth, It last) {   // partitions the range around its nth element.
+            std::nth_element(first, nth, last, [](bigint const &a, bigint const &b) { return compareDecimal(a.str, b.str) < 0; });
+        }
+        template<class It> static std::pair<It, It> _big_minmax(It first, It last) {   // iterators to the smallest and largest Big Integers.
+            return std::minmax_element(first, last, [](bigint const &a, bigint const &b) { return compareDecimal(a.str, b.str) < 0; });
         }
-        static bigint _big_min(bigint &a, bigint &b) {      // returns the minimum value between two Big Integers.
-            bigint ans;
-            ans.str = minimum(a.str, b.str);
-            return ans;
-        }        
         static bigint _big_abs(bigint &a) {                 // returns the absolute value of Big Integer.
             bigint ans;
             ans.str = abs(a.str);
@@ -628,17 +986,91 @@ class bigint {
             ans.str = lcm(a.str, b.str);
             return ans;
         }
+        static bigint _big_divexact(bigint const &a, bigint const &b) {  // returns a/b, when b is known to divide a exactly.
+            bigint ans;
+            ans.str = divexact(a.str, b.str);
+            return ans;
+        }
         static bigint _big_fact(bigint &a) {                    // returns the factorial of Big Integer.
             bigint ans;
             ans.str = fact(a.str);
             return ans;
         }
+        static bigint _big_productRange(bigint const &lo, bigint const &hi) {  // returns lo * (lo+1) * ... * hi.
+            bigint ans;
+            ans.str = productRange(lo.str, hi.str);
+            return ans;
+        }
+        static bigint _big_fib(bigint const &n) {              // returns the n-th Fibonacci number, F(-n) = (-1)^(n+1) F(n).
+            bigint ans;
+            ans.str = fib(n.str);
+            return ans;
+        }
+        static bigint _big_lucas(bigint const &n) {            // returns the n-th Lucas number, L(-n) = (-1)^n L(n).
+            bigint ans;
+            ans.str = lucas(n.str);
+            return ans;
+        }
+        static bigint _big_binomial(bigint const &n, bigint const &k) {   // returns C(n, k), 0 for k < 0 or k > n >= 0.
+            bigint ans;
+            ans.str = binomial(n.str, k.str);
+            return ans;
+        }
+        static void _big_setThreads(unsigned int n) {          // number of threads big_fact / big_productRange / big_fib / big_binomial may use.
+            threadCount() = n == 0 ? 1 : n;
+        }
         static bool _big_isPalindrome(bigint &a) {              // Check if the Big Integer is Palindromic Integer.
             return isPalindrome(a.str);
         }
-        static bool _big_isPrime(bigint &a) {                   // Check if the Big Integer is Prime Integer.
-            return isPrime(a.str);
+        static bool _big_isPrime(bigint const &a, int rounds = 0) {   // Check if the Big Integer is Prime Integer (BPSW + rounds random Miller-Rabin bases).
+            return isPrime(a.str, rounds);
+        }
+        static bigint _big_powmod(bigint const &a, bigint const &b, bigint const &m) {  // returns a^b mod m, in [0, m).
+            bigint ans;
+            ans.str = powmod(a.str, b.str, m.str);
+            return ans;
+        }
+        static int _big_jacobi(bigint const &a, bigint const &n) {            // Jacobi symbol (a/n), n odd and positive.
+            return jacobi(a.str, n.str);
+        }
+        static int _big_legendre(bigint const &a, bigint const &p) {          // Legendre symbol (a/p), p an odd prime.
+            return jacobi(a.str, p.str);
+        }
+        static int _big_kronecker(bigint const &a, bigint const &n) {         // Kronecker symbol (a/n), any n.
+            return kronecker(a.str, n.str);
+        }
+        static bigint _big_sqrtmod(bigint const &a, bigint const &p) {        // the smaller root r of r^2 = a mod p, p prime; throws if a is a non-residue.
+            bigint ans;
+            ans.str = sqrtmod(a.str, p.str);
+            return ans;
+        }
+        static unsigned long long _big_trialDivide(bigint const &a, unsigned long long bound) {  // smallest prime factor p <= bound of a, or 0.
+            return trialDivide(a.str, bound);
+        }
+        static std::vector<bigint> _big_factor(bigint const &a) {              // prime factors of a, ascending, with multiplicity.
+            return _big_factor(a, factorOptions());
+        }
+        static std::vector<bigint> _big_factor(bigint const &a, factorOptions const &options) {   // as above, a cofactor no stage could split is returned as is.
+            std::vector<bigint> ans;
+            for(std::string& f : factor(a.str, options)) {
+                bigint b;
+                b.str = f;
+                ans.push_back(b);
+            }
+            return ans;
+        }
+        static bigint _big_nextPrime(bigint const &a) {         // smallest prime > a.
+            bigint ans;
+            ans.str = nextPrime(a.str);
+            return ans;
+        }
+        static bigint _big_prevPrime(bigint const &a) {         // largest prime < a, throws if a <= 2.
+            bigint ans;
+            ans.str = prevPrime(a.str);
+            return ans;
         }
+        static primeRange _big_primeRange(bigint const &lo, bigint const &hi);   // the primes in [lo, hi), in increasing order.
+        static bigint _big_crt(std::vector<bigint> const &residues, std::vector<bigint> const &moduli);   // x in [0, prod moduli) with x = residues[i] mod moduli[i].
 
         // to biginteger functions
 
@@ -665,17 +1097,303 @@ class bigint {
 
 };
 
+// Input range over the primes in [lo, hi): for(bigint p : big_primeRange(lo, hi)) ...
 
-bool bigint::is_bigint(std::string s) {                              // Checks if the feeded integer is valid Number or not.
-    if(s[0] == '-')
-        s.erase(0, 1);
-    for(unsigned long long int i = 0; i < s.length(); ++i) {
-        if(!((int)s[i] > 47 && (int)s[i] < 58))
+class bigint::primeRange {
+    public:
+        class iterator {
+            public:
+                using iterator_category = std::input_iterator_tag;
+                using value_type = bigint;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const bigint*;
+                using reference = const bigint&;
+
+                iterator() {}                                   // the end iterator
+                reference operator*() const { return current; }
+                pointer operator->() const { return &current; }
+                iterator& operator++() {
+                    advance();
+                    return *this;
+                }
+                iterator operator++(int) {
+                    iterator old = *this;
+                    advance();
+                    return old;
+                }
+                bool operator==(const iterator& other) const {
+                    return done == other.done && (done || current.str == other.current.str);
+                }
+                bool operator!=(const iterator& other) const {
+                    return !(*this == other);
+                }
+
+            private:
+                friend class primeRange;
+                iterator(const limbs&, const limbs&);
+                void advance();
+
+                limbs base, hi;                                 // current window starts at base
+                std::vector<char> composite;
+                size_t pos = 0;
+                bool done = true;
+                bigint current;
+        };
+
+        primeRange(bigint const &lo, bigint const &hi);
+        iterator begin() const { return iterator(lo, hi); }
+        iterator end() const { return iterator(); }
+
+    private:
+        limbs lo, hi;
+};
+
+// Precomputed Chinese remainder basis for pairwise coprime moduli, reusable for any number of reconstructions.
+
+class bigint::crtBasis {
+    public:
+        explicit crtBasis(std::vector<bigint> const &moduli);
+        bigint combine(std::vector<bigint> const &residues) const;          // x in [0, M) with x = residues[i] mod moduli[i]
+        bigint combine(std::vector<std::uint32_t> const &residues) const;   // same, for residues given as words
+        std::vector<bigint> reduce(bigint const &x) const;                  // x mod moduli[i], each in [0, moduli[i])
+        bigint modulus() const;                                             // M, the product of the moduli
+        size_t size() const { return m.size(); }
+
+    private:
+        friend class rnsInt;
+        std::vector<limbs> m, y;                        // moduli, and y[i] = (M / m[i])^-1 mod m[i]
+        std::vector<limbs> tree;                        // subproduct tree: node 1 holds M, node i has children 2i, 2i+1
+        void build(size_t, size_t, size_t);
+        limbs combineTree(const std::vector<limbs>&, size_t, size_t, size_t) const;
+        void reduceTree(const limbs&, size_t, size_t, size_t, std::vector<limbs>&) const;
+        limbs combineLimbs(std::vector<limbs>) const;
+};
+
+// Residue number system: word sized primes p[i] < 2^32 whose product exceeds 2^(bits+1),
+// enough to hold any value in [-2^bits, 2^bits].
+
+class bigint::rnsBasis {
+    public:
+        explicit rnsBasis(size_t bits);
+        size_t size() const { return primes.size(); }
+        const std::vector<std::uint32_t>& moduli() const { return primes; }
+        const crtBasis& crt() const { return basis; }
+
+    private:
+        friend class rnsInt;
+        static std::vector<std::uint32_t> pickPrimes(size_t);
+        static std::vector<bigint> asBigints(const std::vector<std::uint32_t>&);
+        std::vector<std::uint32_t> primes;
+        std::vector<std::uint64_t> barrett;             // floor((2^64 - 1) / p[i])
+        crtBasis basis;
+};
+
+// A value held as its residues modulo the primes of an rnsBasis. +, - and * work lane by lane
+// with no carries between lanes; the bigint is rebuilt by one CRT in toBigint().
+
+class bigint::rnsInt {
+    public:
+        explicit rnsInt(std::shared_ptr<const rnsBasis> basis, bigint const &value = bigint());
+        bigint toBigint() const;                        // the value in (-M/2, M/2]
+        const std::vector<std::uint32_t>& residues() const { return lanes; }
+
+        rnsInt& operator+=(const rnsInt&);
+        rnsInt& operator-=(const rnsInt&);
+        rnsInt& operator*=(const rnsInt&);
+        rnsInt operator+(const rnsInt& b) const { rnsInt r = *this; return r += b; }
+        rnsInt operator-(const rnsInt& b) const { rnsInt r = *this; return r -= b; }
+        rnsInt operator*(const rnsInt& b) const { rnsInt r = *this; return r *= b; }
+        rnsInt operator-() const;
+        bool operator==(const rnsInt& b) const { return lanes == b.lanes; }
+        bool operator!=(const rnsInt& b) const { return lanes != b.lanes; }
+
+    private:
+        void checkBasis(const rnsInt&) const;
+        std::shared_ptr<const rnsBasis> basis;
+        std::vector<std::uint32_t> lanes;
+};
+
+// Read-only view of one serialize() record in memory someone else owns, typically a mappedFile.
+// Comparisons between views read the words in place; anything else converts through bigint(view).
+
+class bigint::view {
+    public:
+        view() {}                                       // zero
+        view(const unsigned char *record, const unsigned char *last);   // the record at record, throws if malformed
+        size_t size() const { return count; }           // magnitude words
+        size_t bytes() const { return end - record; }   // length of the whole record
+        bool negative() const { return neg; }
+        std::uint32_t word(size_t i) const;             // i-th least significant magnitude word
+        bigint toBigint() const { return bigint(*this); }
+
+        int compare(const view&) const;                 // -1, 0 or 1
+        int compare(bigint const&) const;
+        template<class T> bool operator==(const T& b) const { return compare(b) == 0; }
+        template<class T> bool operator!=(const T& b) const { return compare(b) != 0; }
+        template<class T> bool operator<(const T& b) const { return compare(b) < 0; }
+        template<class T> bool operator<=(const T& b) const { return compare(b) <= 0; }
+        template<class T> bool operator>(const T& b) const { return compare(b) > 0; }
+        template<class T> bool operator>=(const T& b) const { return compare(b) >= 0; }
+
+    private:
+        friend class bigint;
+        const unsigned char *record = nullptr, *payload = nullptr, *end = nullptr;
+        size_t count = 0;
+        bool neg = false;
+};
+
+// A file of back to back serialize() records, mapped read-only. Records are indexed lazily: looking
+// up record i scans only as far as i. Views handed out stay valid while the mappedFile lives.
+// The const members may be called from any number of threads at once: the index grows, and is
+// read, under a mutex, and views only read the mapping.
+
+class bigint::mappedFile {
+    public:
+        explicit mappedFile(std::string const &path);
+        ~mappedFile();
+        mappedFile(const mappedFile&) = delete;
+        mappedFile& operator=(const mappedFile&) = delete;
+
+        size_t size() const;                            // number of records, indexes the whole file
+        view operator[](size_t i) const;                // record i, the file must hold at least i + 1 records
+        view at(size_t i) const;                        // record i, throws std::out_of_range past the end
+
+    private:
+        bool indexUpTo(size_t) const;                   // callers hold guard
+        bool locate(size_t, size_t&) const;
+        const unsigned char *base = nullptr;
+        size_t length = 0;
+        std::vector<unsigned char> buffer;              // the file contents where mmap is unavailable
+        mutable std::mutex guard;                       // over offsets and scanned
+        mutable std::vector<size_t> offsets;            // offsets of the records indexed so far
+        mutable size_t scanned = 0;                     // offset just past the last indexed record
+};
+
+// A bigint keyed for hash containers: its fingerprint is computed once, so that the hash is O(1)
+// and unequal keys are nearly always told apart without reading their digits.
+
+class bigint::hashKey {
+    public:
+        hashKey(bigint value) : number(std::move(value)), print(number.fingerprint()) {}
+        const bigint& value() const { return number; }
+        std::uint64_t fingerprint() const { return print; }
+        size_t hash() const { return mixBits(print); }
+
+        bool operator==(const hashKey& b) const { return print == b.print && number == b.number; }
+        bool operator!=(const hashKey& b) const { return !(*this == b); }
+
+    private:
+        bigint number;
+        std::uint64_t print;
+};
+
+namespace std {
+    template<> struct hash<bigint> {
+        size_t operator()(bigint const &n) const noexcept { return n.hash(); }
+    };
+    template<> struct hash<bigint::hashKey> {
+        size_t operator()(bigint::hashKey const &k) const noexcept { return k.hash(); }
+    };
+}
+
+
+bool bigint::is_bigint(const std::string& s) {                       // Checks if the feeded integer is valid Number or not.
+    size_t beg = (!s.empty() && s[0] == '-') ? 1 : 0;
+    return s.length() > beg && allDigits(s.data() + beg, s.length() - beg);
+}
+
+
+/*
+        ______________________________________________________
+                  Digit Validation and Parsing Functions
+        ______________________________________________________
+                      Algorithm Explanation
+
+        Validation checks a whole block of characters per step:
+        - AVX2 (32 bytes) or SSE2 (16 bytes): compare the block against '0' - 1 and '9' + 1
+          as signed bytes, so anything non-ASCII also fails, and test the movemask.
+        - SWAR (8 bytes in a 64 bit word): a byte is a digit iff its high nibble is 3 and
+          its low nibble plus 6 does not carry into the high nibble.
+        The widest variant the CPU supports is chosen once, at first use, and the tail
+        shorter than a block falls through to the narrower ones.
+
+        Parsing turns 8 digits loaded as one little endian word into their value with three
+        multiply-shift steps, combining neighbouring digits, then pairs, then quads:
+        d = (d * (1 + 10*2^8)) >> 8, then (d * (1 + 100*2^16)) >> 16, then
+        (d * (1 + 10000*2^32)) >> 32, masking out the lanes that are not needed.
+
+        Algorithmic Time Complexity : O(n)
+        Algorithmic Space Complexity : O(1)
+*/
+
+bool bigint::allDigits(const char* p, size_t n) {                    // every p[0..n) is '0'..'9'
+#ifdef BIGINT_X86_SIMD
+    static const bool avx2 = __builtin_cpu_supports("avx2");
+    return avx2 ? allDigitsAVX2(p, n) : allDigitsSSE2(p, n);
+#else
+    return allDigitsScalar(p, n);
+#endif
+}
+
+bool bigint::allDigitsScalar(const char* p, size_t n) {
+    size_t i = 0;
+    for(; i + 8 <= n; i += 8) {
+        std::uint64_t v;
+        std::memcpy(&v, p + i, 8);
+        std::uint64_t high = v & 0xF0F0F0F0F0F0F0F0ull;
+        std::uint64_t carry = ((v + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4;
+        if((high | carry) != 0x3333333333333333ull)
+            return false;
+    }
+    for(; i < n; ++i) {
+        if(p[i] < '0' || p[i] > '9')
             return false;
     }
     return true;
 }
 
+#ifdef BIGINT_X86_SIMD
+bool bigint::allDigitsSSE2(const char* p, size_t n) {
+    const __m128i lo = _mm_set1_epi8('0' - 1), hi = _mm_set1_epi8('9' + 1);
+    size_t i = 0;
+    for(; i + 16 <= n; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(p + i));
+        __m128i ok = _mm_and_si128(_mm_cmpgt_epi8(x, lo), _mm_cmplt_epi8(x, hi));
+        if(_mm_movemask_epi8(ok) != 0xFFFF)
+            return false;
+    }
+    return allDigitsScalar(p + i, n - i);
+}
+
+__attribute__((target("avx2"))) bool bigint::allDigitsAVX2(const char* p, size_t n) {
+    const __m256i lo = _mm256_set1_epi8('0' - 1), hi = _mm256_set1_epi8('9' + 1);
+    size_t i = 0;
+    for(; i + 32 <= n; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(p + i));
+        __m256i ok = _mm256_and_si256(_mm256_cmpgt_epi8(x, lo), _mm256_cmpgt_epi8(hi, x));
+        if((std::uint32_t)_mm256_movemask_epi8(ok) != 0xFFFFFFFFu)
+            return false;
+    }
+    return allDigitsSSE2(p + i, n - i);
+}
+#endif
+
+std::uint32_t bigint::parseEightDigits(const char* p) {              // value of the digits p[0..8)
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    std::uint64_t v;
+    std::memcpy(&v, p, 8);
+    v -= 0x3030303030303030ull;
+    v = (v * 2561) >> 8 & 0x00FF00FF00FF00FFull;
+    v = (v * 6553601) >> 16 & 0x0000FFFF0000FFFFull;
+    return (std::uint32_t)((v * 42949672960001ull) >> 32);
+#else
+    std::uint32_t v = 0;
+    for(int i = 0; i < 8; ++i)
+        v = v*10 + (p[i] - '0');
+    return v;
+#endif
+}
+
 
 //---------------------------------------------------------
 //--------Internal Arithmetic functions Definitions--------
@@ -770,8 +1488,7 @@ std::string bigint::subtract(std::string str1, std::string str2) {
             bigint t1(str1.erase(0, 1));
             bigint t2(str2.erase(0, 1));
             std::string temp = subtract(t2.str, t1.str);
-            bigint mx = maximum(t2.str, t1.str);
-            if(temp[0] != '-' && mx.str == t1.str)
+            if(temp[0] != '-' && is_strictlyMaximum(t1.str, t2.str))
                 sum = "-" + temp;
             else
                 sum = temp;
@@ -791,16 +1508,10 @@ std::string bigint::subtract(std::string str1, std::string str2) {
             sum = "-" + subtract(str1, str2);
             return trim(sum);
         } else if(str1_len == str2_len) {
-            bigint a(str1);
-            bigint b(str2);
-            bigint mx = maximum(a.str, b.str);
-            if(mx.str == str2) {
+            if(is_strictlyMinimum(str1, str2)) {
                 std::string tp = str1;
                 str1 = str2;
                 str2 = tp;
-                bigint t1(str1);
-                bigint t2(str2);
-                bigint temp = subtract(str1, str2);
                 sum = "-" + subtract(str1, str2);
                 return trim(sum);
             }
@@ -951,7 +1662,7 @@ std::string bigint::divide(std::string str1, std::string str2) {
             std::string temp = str2;
             ans = "0";
             std::string count = "0";
-            while(str1 == maximum(str1, str2)) {
+            while(is_maximum(str1, str2)) {
                 int lenDiff = str1.length() - str2.length();
                 if(lenDiff > 0 && str1[0] > str2[0]) {
                     count = add(count, pow("10", std::to_string(lenDiff)));
@@ -996,355 +1707,4026 @@ std::string bigint::mod(std::string str1, std::string str2) {                  /
     return ans;
 }
 
+/*
+        ______________________________________________________
+                      Exact Division Function
+        ______________________________________________________
+                      Algorithm Explanation
+
+        When the divisor is known to divide the dividend (as in lcm or reducing a fraction
+        by its gcd), the quotient can be found from the low end (Jebelean / Hensel division).
+        Working in base 10^9, the divisor is first made coprime to the base: common factors
+        of ten are dropped, and any remaining power of 2 (or of 5) is turned into a power of
+        ten by multiplying both operands with the matching power of 5 (or of 2). Then every
+        quotient limb is q[i] = r[i] * d[0]^-1 mod 10^9, and q[i]*d is subtracted from r.
+        Only the low (n - m + 1) limbs of the dividend are ever touched and no quotient
+        digit has to be estimated or corrected.
+
+        The result is unspecified if str2 does not divide str1.
+
+        Algorithmic Time Complexity : O((n-m)*m)
+        Algorithmic Space Complexity : O(n)
+        where n ans m are the lengths of respective strings(Integers) provided.
+*/
+
+std::string bigint::divexact(std::string str1, std::string str2) {           // return str1/str2, given that str2 divides str1
+    bool neg = (str1[0] == '-') != (str2[0] == '-');
+    limbs d = toLimbs(str2);
+    if(d.empty())
+        throw std::runtime_error("Division by zero.");
+    return fromLimbs(divexactLimbs(toLimbs(str1), d), neg);
+}
+
+bigint::limbs bigint::divexactLimbs(limbs n, limbs d) {
+    if(n.empty() || n.size() < d.size())
+        return limbs();
 
-std::string bigint::maximum(std::string str1, std::string str2) {              // return maximum of both strings.
-    std::string max = "";
-    bool bothNeg = false;
-    bool isMax1 = false;
-    bool isMax2 = false;
-    if(str1[0] == '-' && str2[0] == '-') {
-        bothNeg = true;
-        str1.erase(0, 1);
-        str2.erase(0, 1);
-    } else if(str1[0] == '-') {
-        return trim(str2);
-    } else if(str2[0] == '-') {
-        return trim(str1);
-    }
-    int str1_len = str1.length(), str2_len = str2.length();
-    if(str1_len == str2_len) {
-        for(int i = 0; i < str1_len; ++i) {
-            if(str1[i] != str2[i]) {
-                if(str1[i] > str2[i]) {
-                    isMax1 = true;
-                } else {
-                    isMax2 = true;
-                }
+    // Drop the factors of ten shared by divisor and dividend.
+    size_t zeros = 0;
+    while(d[zeros] == 0)
+        zeros++;
+    n.erase(n.begin(), n.begin() + zeros);
+    d.erase(d.begin(), d.begin() + zeros);
+    while(d[0] % 10 == 0) {
+        divLimbsSmall(d, 10);
+        divLimbsSmall(n, 10);
+    }
+
+    // 2^e * m  ->  10^e * m, and likewise for 5^e, so that d[0] is invertible mod 10^9.
+    static const std::uint32_t pow5[] = {1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125};
+    static const std::uint32_t pow10[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+    while(d[0] % 2 == 0) {
+        int e = 0;
+        for(std::uint32_t v = d[0]; v % 2 == 0 && e < LIMB_DIGITS; v /= 2)
+            e++;
+        mulLimbsSmall(d, pow5[e]);
+        mulLimbsSmall(n, pow5[e]);
+        divLimbsSmall(d, pow10[e]);
+        divLimbsSmall(n, pow10[e]);
+    }
+    while(d[0] % 5 == 0) {
+        int e = 0;
+        for(std::uint32_t v = d[0]; v % 5 == 0 && e < LIMB_DIGITS; v /= 5)
+            e++;
+        mulLimbsSmall(d, 1u << e);
+        mulLimbsSmall(n, 1u << e);
+        divLimbsSmall(d, pow10[e]);
+        divLimbsSmall(n, pow10[e]);
+    }
+    if(n.size() < d.size())
+        return limbs();
+
+    std::uint64_t inv = inverseModBase(d[0]);
+
+    size_t qlen = n.size() - d.size() + 1;
+    n.resize(qlen);
+    limbs q(qlen, 0);
+    for(size_t i = 0; i < qlen; ++i) {
+        std::uint64_t qi = (std::uint64_t)n[i] * inv % LIMB_BASE;
+        q[i] = (std::uint32_t)qi;
+        if(qi == 0)
+            continue;
+        std::uint64_t carry = 0;
+        long long int borrow = 0;
+        for(size_t j = 0; i + j < qlen; ++j) {
+            if(j >= d.size() && carry == 0 && borrow == 0)
                 break;
+            std::uint64_t t = (j < d.size() ? qi * d[j] : 0) + carry;
+            carry = t / LIMB_BASE;
+            long long int cur = (long long int)n[i+j] - (long long int)(t % LIMB_BASE) - borrow;
+            borrow = 0;
+            if(cur < 0) {
+                cur += LIMB_BASE;
+                borrow = 1;
             }
+            n[i+j] = (std::uint32_t)cur;
         }
-        if(!(isMax2 ^ isMax1)) {
-            isMax1 = true;
-        }
-    } else if(str1_len > str2_len) {
-        isMax1 = true;
-    } else {
-        isMax2 = true;
-    }
-    if(bothNeg) {
-        if(isMax1)
-            return ("-" + trim(str2));
-        else 
-            return ("-" + trim(str1));
-    } else {
-        if(isMax1)
-            return trim(str1);
-        else 
-            return trim(str2);
     }
+    trimLimbs(q);
+    return q;
 }
 
-std::string bigint::minimum(std::string str1, std::string str2) {              // return minimum of both strings.
-    std::string ans = maximum(str1, str2);
-    if(ans == str1)
-        return str2;
-    return str1;
-}
 
-bool bigint::is_maximum(std::string str1, std::string str2) {             //checks if str1 >= str2, numerically
-    if(str1 == maximum(str1, str2))
-        return true;
-    return false;
-}
+/*
+        ______________________________________________________
+                        Comparison Functions
+        ______________________________________________________
+                      Algorithm Explanation
 
-bool bigint::is_minimum(std::string str1, std::string str2) {             //checks if str1 <= str2, numerically
-    if(str2 == maximum(str1, str2))
-        return true;
-    return false;
+        Every comparison goes through one three-way compare that reads both strings in
+        place: first the signs (with -0 counted as 0), then the number of significant
+        digits once leading zeros are skipped, then the digits themselves, most
+        significant first, with memcmp. Nothing is copied or allocated.
+
+        Algorithmic Time Complexity : O(n), O(1) when the signs or lengths differ
+        Algorithmic Space Complexity : O(1)
+*/
+
+int bigint::compareDecimal(const std::string& str1, const std::string& str2) {   // -1, 0 or 1 as str1 <, ==, > str2, numerically
+    size_t i = str1[0] == '-', j = str2[0] == '-';
+    bool neg1 = i, neg2 = j;
+    while(i + 1 < str1.length() && str1[i] == '0')
+        i++;
+    while(j + 1 < str2.length() && str2[j] == '0')
+        j++;
+    size_t len1 = str1.length() - i, len2 = str2.length() - j;
+    if(len1 == 1 && str1[i] == '0')
+        neg1 = false;
+    if(len2 == 1 && str2[j] == '0')
+        neg2 = false;
+    if(neg1 != neg2)
+        return neg1 ? -1 : 1;
+    int sign = neg1 ? -1 : 1;
+    if(len1 != len2)
+        return len1 < len2 ? -sign : sign;
+    int c = std::memcmp(str1.data() + i, str2.data() + j, len1);
+    return c == 0 ? 0 : c < 0 ? -sign : sign;
 }
 
-bool bigint::is_strictlyMaximum(std::string str1, std::string str2) {    //checks if str1 > str2, numerically
-    if(str1 == str2)
-        return false;
-    if(str1 == maximum(str1, str2))
-        return true;
-    return false;
+int bigint::compareMagnitude(const std::string& s, bool negative, unsigned __int128 v) {
+    // -1, 0 or 1 as s <, ==, > the value with the given sign and magnitude; at most 39 digits are read
+    size_t i = s[0] == '-';
+    bool neg = i;
+    while(i + 1 < s.length() && s[i] == '0')
+        i++;
+    size_t len = s.length() - i;
+    if(len == 1 && s[i] == '0')
+        neg = false;
+    if(v == 0)
+        negative = false;
+    if(neg != negative)
+        return neg ? -1 : 1;
+    int sign = neg ? -1 : 1;
+    if(len > 39)                                        // 2^128 has 39 digits
+        return sign;
+    const unsigned __int128 limit = ~(unsigned __int128)0 / 10;
+    unsigned __int128 x = 0;
+    for(; i < s.length(); ++i) {
+        unsigned d = s[i] - '0';
+        if(x > limit || (x == limit && d > (unsigned)(~(unsigned __int128)0 % 10)))
+            return sign;
+        x = x*10 + d;
+    }
+    return x == v ? 0 : x < v ? -sign : sign;
 }
 
-bool bigint::is_strictlyMinimum(std::string str1, std::string str2) {    //checks if str1 < str2, numerically
-    if(str1 == str2)
-        return false;
-    if(str2 == maximum(str1, str2))
-        return true;
-    return false;
+int bigint::signDecimal(const std::string& s) {                      // -1, 0 or 1
+    size_t i = s[0] == '-';
+    while(i < s.length() && s[i] == '0')
+        i++;
+    if(i == s.length())
+        return 0;
+    return s[0] == '-' ? -1 : 1;
 }
 
-std::string bigint::trim(std::string s) {                         // function to remove zeros
-    if(s == "0")
-        return s;
-    if(s[0] == '-') {
-        int i = 1;
-        while(s[i] == '0') {
-            s.erase(i, 1);
-        }
-        return s;
-    } else if(s[0] == '0') {
-        int i = 0;
-        while(s[i] == '0') {
-            s.erase(i, 1);
-        }
-        return s;
+/*
+        ______________________________________________________
+                          Sorting Functions
+        ______________________________________________________
+                      Algorithm Explanation
+
+        big_sort never compares two bigints while the order is still coarse:
+        - each value gets a fixed size key: a bucket from its sign and number of
+          significant digits (negatives longest first), and a prefix made of its first 16
+          significant digits, parsed 8 at a time (bit inverted for negatives).
+        - the keys are LSD radix sorted on the prefix, 16 bits per pass, skipping passes
+          in which every key has the same digit, then the same way on the bucket, taken
+          as an offset from the lowest bucket so that short lengths need a single pass.
+        - only runs of equal keys from values longer than 16 digits are finished with the
+          full three-way compare.
+        The values are then moved once into their final places. big_parallelSort sorts
+        slices on separate threads and merges them pairwise.
+
+        Algorithmic Time Complexity : O(n) for the keys (at most 4 passes on the prefix and 4 on the
+                                      bucket), plus O(k log k * d) for tied runs
+        Algorithmic Space Complexity : O(n)
+*/
+
+std::vector<size_t> bigint::sortPermutation(const std::vector<const std::string*>& values) {
+    // order[i] is the index of the value that belongs at position i
+    struct sortKey {
+        std::uint64_t bucket, prefix;
+        size_t index;
+    };
+    size_t n = values.size();
+    std::vector<sortKey> keys(n), spare(n);
+    std::uint64_t lowest = ~(std::uint64_t)0;
+    for(size_t k = 0; k < n; ++k) {
+        const std::string& s = *values[k];
+        size_t i = s[0] == '-';
+        while(i + 1 < s.length() && s[i] == '0')
+            i++;
+        size_t len = s.length() - i;
+        bool zero = len == 1 && s[i] == '0', negative = s[0] == '-' && !zero;
+        std::uint64_t prefix = 0;
+        size_t take = std::min<size_t>(len, 16), j = 0;
+        for(; j + 8 <= take; j += 8)
+            prefix = prefix * 100000000 + parseEightDigits(&s[i+j]);
+        for(; j < take; ++j)
+            prefix = prefix * 10 + (s[i+j] - '0');
+        const std::uint64_t middle = (std::uint64_t)1 << 63;
+        keys[k].bucket = zero ? middle : negative ? middle - len : middle + len;
+        keys[k].prefix = negative ? ~prefix : prefix;
+        keys[k].index = k;
+        lowest = std::min(lowest, keys[k].bucket);
     }
+    auto radix = [&](std::uint64_t sortKey::*field, std::uint64_t base) {   // stable LSD radix on key.*field - base
+        for(int shift = 0; shift < 64; shift += 16) {
+            std::vector<size_t> count(65537, 0);
+            for(size_t k = 0; k < n; ++k)
+                count[(((keys[k].*field - base) >> shift) & 0xFFFF) + 1]++;
+            if(std::find(count.begin(), count.end(), n) != count.end())
+                continue;
+            for(size_t d = 1; d < count.size(); ++d)
+                count[d] += count[d-1];
+            for(size_t k = 0; k < n; ++k)
+                spare[count[((keys[k].*field - base) >> shift) & 0xFFFF]++] = keys[k];
+            keys.swap(spare);
+        }
+    };
+    radix(&sortKey::prefix, 0);
+    radix(&sortKey::bucket, lowest);
+    for(size_t a = 0; a < n; ) {                                   // runs of equal keys need the full compare
+        size_t b = a + 1;
+        while(b < n && keys[b].bucket == keys[a].bucket && keys[b].prefix == keys[a].prefix)
+            b++;
+        if(b - a > 1)
+            std::sort(keys.begin() + a, keys.begin() + b, [&](const sortKey& x, const sortKey& y) {
+                return compareDecimal(*values[x.index], *values[y.index]) < 0;
+            });
+        a = b;
+    }
+    std::vector<size_t> order(n);
+    for(size_t k = 0; k < n; ++k)
+        order[k] = keys[k].index;
+    return order;
+}
+
+std::string bigint::maximum(const std::string& str1, const std::string& str2) {    // return maximum of both strings.
+    return trim(compareDecimal(str1, str2) >= 0 ? str1 : str2);
+}
+
+std::string bigint::minimum(const std::string& str1, const std::string& str2) {    // return minimum of both strings.
+    return trim(compareDecimal(str1, str2) <= 0 ? str1 : str2);
+}
+
+bool bigint::is_maximum(const std::string& str1, const std::string& str2) {        //checks if str1 >= str2, numerically
+    return compareDecimal(str1, str2) >= 0;
+}
+
+bool bigint::is_minimum(const std::string& str1, const std::string& str2) {        //checks if str1 <= str2, numerically
+    return compareDecimal(str1, str2) <= 0;
+}
+
+bool bigint::is_strictlyMaximum(const std::string& str1, const std::string& str2) { //checks if str1 > str2, numerically
+    return compareDecimal(str1, str2) > 0;
+}
+
+bool bigint::is_strictlyMinimum(const std::string& str1, const std::string& str2) { //checks if str1 < str2, numerically
+    return compareDecimal(str1, str2) < 0;
+}
+
+std::string bigint::trim(std::string s) {                         // function to remove zeros, "0" when nothing else is left
+    size_t sign = s[0] == '-';
+    size_t i = s.find_first_not_of('0', sign);
+    if(i == std::string::npos)
+        return "0";
+    s.erase(sign, i - sign);
     return s;
 }
 
 
-//____________________________________________________________________________________________
+//---------------------------------------------------------
+//--------Limb kernels (base 10^9, little endian)----------
+//---------------------------------------------------------
+
+bigint::limbs bigint::toLimbs(const std::string& s) {            // magnitude of s as base 10^9 limbs, sign is ignored
+    size_t beg = (!s.empty() && s[0] == '-') ? 1 : 0;
+    limbs a;
+    a.reserve((s.length() - beg) / LIMB_DIGITS + 1);
+    for(size_t end = s.length(); end > beg; ) {
+        size_t start = end > beg + LIMB_DIGITS ? end - LIMB_DIGITS : beg;
+        std::uint32_t limb = 0;
+        if(end - start == LIMB_DIGITS)
+            limb = parseEightDigits(&s[start]) * 10 + (s[end-1] - '0');
+        else
+            for(size_t i = start; i < end; ++i)
+                limb = limb*10 + (s[i] - '0');
+        a.push_back(limb);
+        end = start;
+    }
+    trimLimbs(a);
+    return a;
+}
 
+std::string bigint::fromLimbs(const limbs& a, bool negative) {    // decimal string of the limbs, with '-' if negative
+    if(a.empty())
+        return "0";
+    std::string s = std::to_string(a.back());
+    size_t head = s.length();
+    if(negative) {
+        s.insert(s.begin(), '-');
+        head++;
+    }
+    s.resize(head + (a.size() - 1) * LIMB_DIGITS);
+    char *out = &s[head];
+    for(size_t i = a.size() - 1; i-- > 0; ) {
+        std::uint32_t limb = a[i];
+        for(int k = LIMB_DIGITS - 1; k >= 0; --k) {
+            out[k] = (char)('0' + limb % 10);
+            limb /= 10;
+        }
+        out += LIMB_DIGITS;
+    }
+    return s;
+}
 
+void bigint::trimLimbs(limbs& a) {                               // drops the most significant zero limbs
+    while(!a.empty() && a.back() == 0)
+        a.pop_back();
+}
 
-std::string bigint::abs(std::string s) {                          // returns absolute value of string
-    if(s[0] == '-')
-        s.erase(0, 1);
+void bigint::mulLimbsSmall(limbs& a, std::uint32_t m) {         // a *= m
+    std::uint64_t carry = 0;
+    for(size_t i = 0; i < a.size(); ++i) {
+        std::uint64_t t = (std::uint64_t)a[i] * m + carry;
+        a[i] = (std::uint32_t)(t % LIMB_BASE);
+        carry = t / LIMB_BASE;
+    }
+    while(carry) {
+        a.push_back((std::uint32_t)(carry % LIMB_BASE));
+        carry /= LIMB_BASE;
+    }
+    trimLimbs(a);
+}
+
+std::uint32_t bigint::divLimbsSmall(limbs& a, std::uint32_t m) {  // a /= m, returns a % m
+    std::uint64_t rem = 0;
+    for(size_t i = a.size(); i-- > 0; ) {
+        std::uint64_t cur = rem * LIMB_BASE + a[i];
+        a[i] = (std::uint32_t)(cur / m);
+        rem = cur % m;
+    }
+    trimLimbs(a);
+    return (std::uint32_t)rem;
+}
+
+size_t bigint::removeTwos(limbs& a) {                          // a = 2^s * d with d odd: a becomes d, returns s (a > 0)
+    size_t s;
+    if(a[0] % 512 != 0)                                 // 2^9 divides 10^9, so the lowest limb decides
+        s = __builtin_ctz(a[0]);
+    else {
+        words w = limbsToWords(a);
+        size_t k = 0;
+        while(w[k] == 0)
+            k++;
+        s = 32 * k + __builtin_ctz(w[k]);
+    }
+    for(size_t left = s; left > 0; ) {
+        size_t step = std::min<size_t>(left, 31);
+        divLimbsSmall(a, 1u << step);
+        left -= step;
+    }
     return s;
 }
 
+bigint::limbs bigint::limbsFromU64(std::uint64_t v) {
+    limbs a;
+    while(v) {
+        a.push_back((std::uint32_t)(v % LIMB_BASE));
+        v /= LIMB_BASE;
+    }
+    return a;
+}
+
+int bigint::compareLimbs(const limbs& a, const limbs& b) {       // returns -1, 0 or 1 as a <, ==, > b
+    if(a.size() != b.size())
+        return a.size() < b.size() ? -1 : 1;
+    for(size_t i = a.size(); i-- > 0; ) {
+        if(a[i] != b[i])
+            return a[i] < b[i] ? -1 : 1;
+    }
+    return 0;
+}
+
+void bigint::addLimbsAt(limbs& a, const limbs& b, size_t shift) { // a += b * 10^(9*shift)
+    if(a.size() < b.size() + shift)
+        a.resize(b.size() + shift, 0);
+    std::uint32_t carry = 0;
+    size_t i = 0;
+    for(; i < b.size() || carry; ++i) {
+        if(shift + i == a.size())
+            a.push_back(0);
+        std::uint32_t t = a[shift+i] + carry + (i < b.size() ? b[i] : 0);
+        carry = t >= LIMB_BASE;
+        a[shift+i] = carry ? t - LIMB_BASE : t;
+    }
+    trimLimbs(a);
+}
+
+void bigint::subLimbs(limbs& a, const limbs& b) {                // a -= b, requires a >= b
+    std::uint32_t borrow = 0;
+    for(size_t i = 0; i < b.size() || borrow; ++i) {
+        std::uint32_t sub = borrow + (i < b.size() ? b[i] : 0);
+        borrow = a[i] < sub;
+        a[i] = borrow ? a[i] + LIMB_BASE - sub : a[i] - sub;
+    }
+    trimLimbs(a);
+}
 
 /*
         ______________________________________________________
-                        Power Function
+                    Limb Multiplication Functions
         ______________________________________________________
                       Algorithm Explanation
 
-        It multiplies str1, str2 times and updates the str1 value
-        
-        Algorithmic Time Complexity : O(m), except multiplication time complexity
-        Algorithmic Space Complexity : O(1)
-        where n ans m are the lengths of respective strings(Integers) provided.
+        Three strategies are picked by operand size:
+        - schoolbook for short operands, accumulating each row with a 64 bit carry.
+        - Karatsuba for medium operands: with a = a1*B^m + a0 and b = b1*B^m + b0,
+          a*b = z2*B^2m + (z1 - z2 - z0)*B^m + z0, where z1 = (a1+a0)(b1+b0),
+          so only three half sized products are needed. Unbalanced operands are cut
+          into pieces of the shorter length first.
+        - number theoretic transform for large operands: the limbs are convolved modulo
+          three NTT friendly primes and the exact coefficients (< 2^23 * 10^18) are
+          recovered with Garner's CRT before carrying back into base 10^9. The
+          butterflies multiply by twiddles with Shoup's precomputed quotients, so the
+          transforms never divide.
+
+        Algorithmic Time Complexity : O(n*m), O(n^1.585), O(n log n) respectively
+        Algorithmic Space Complexity : O(n + m)
 */
 
-std::string bigint::pow(std::string str1, std::string str2) {                  // returns str1^str2, ^ -> power, numerically
-    if(str2 == "0") {
-        return "1";
-    } else if(str1 == "0") {
-        if(str2[0] == '-')
-            return std::to_string((long long int)std::pow(0, -5));
-        return "0";
-    } else if(str1[0] == '-' && str2[0] == '-') {
-        if(str1 == "-1" && str2 == "-1") {
-            return "-1";
-        } else if(str1 == "-1") {
-            if((((int)str2[str2.length()-1])-48) & 1) {                
-                return "-1";
-            } else {
-                return "1";
+bigint::limbs bigint::mulLimbs(const limbs& a, const limbs& b, unsigned int threads) {
+    if(a.empty() || b.empty())
+        return limbs();
+    size_t shorter = std::min(a.size(), b.size());
+    if(shorter < KARATSUBA_THRESHOLD)
+        return mulSchool(a.data(), a.size(), b.data(), b.size());
+    if(shorter >= NTT_THRESHOLD && a.size() + b.size() <= NTT_MAX_LENGTH)
+        return mulNTT(a, b, threads);
+    return mulKaratsuba(a, b);
+}
+
+bigint::limbs bigint::mulSchool(const std::uint32_t* a, size_t na, const std::uint32_t* b, size_t nb) {
+    limbs res(na + nb, 0);
+    for(size_t i = 0; i < na; ++i) {
+        std::uint64_t carry = 0, ai = a[i];
+        if(ai == 0)
+            continue;
+        for(size_t j = 0; j < nb; ++j) {
+            std::uint64_t t = ai * b[j] + res[i+j] + carry;
+            res[i+j] = (std::uint32_t)(t % LIMB_BASE);
+            carry = t / LIMB_BASE;
+        }
+        res[i+nb] = (std::uint32_t)carry;
+    }
+    trimLimbs(res);
+    return res;
+}
+
+bigint::limbs bigint::mulKaratsuba(const limbs& x, const limbs& y) {
+    const limbs& a = x.size() >= y.size() ? x : y;
+    const limbs& b = x.size() >= y.size() ? y : x;
+    limbs res;
+    if(2 * b.size() <= a.size()) {
+        for(size_t pos = 0; pos < a.size(); pos += b.size()) {
+            limbs piece(a.begin() + pos, a.begin() + std::min(a.size(), pos + b.size()));
+            trimLimbs(piece);
+            addLimbsAt(res, mulLimbs(piece, b), pos);
+        }
+        return res;
+    }
+    size_t m = a.size() / 2;
+    limbs a0(a.begin(), a.begin() + m), a1(a.begin() + m, a.end());
+    limbs b0(b.begin(), b.begin() + m), b1(b.begin() + m, b.end());
+    trimLimbs(a0);
+    trimLimbs(b0);
+    limbs z0 = mulLimbs(a0, b0);
+    limbs z2 = mulLimbs(a1, b1);
+    addLimbsAt(a0, a1, 0);
+    addLimbsAt(b0, b1, 0);
+    limbs z1 = mulLimbs(a0, b0);
+    subLimbs(z1, z0);
+    subLimbs(z1, z2);
+    res = z0;
+    addLimbsAt(res, z1, m);
+    addLimbsAt(res, z2, 2*m);
+    return res;
+}
+
+std::uint64_t bigint::powmodU64(std::uint64_t b, std::uint64_t e, std::uint64_t m) {  // b^e mod m on machine words
+    unsigned __int128 r = 1 % m, x = b % m;
+    while(e) {
+        if(e & 1)
+            r = r * x % m;
+        x = x * x % m;
+        e >>= 1;
+    }
+    return (std::uint64_t)r;
+}
+
+void bigint::ntt(std::vector<std::uint32_t>& a, bool invert, std::uint32_t mod) {
+    size_t n = a.size();
+    for(size_t i = 1, j = 0; i < n; ++i) {
+        size_t bit = n >> 1;
+        for(; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if(i < j)
+            std::swap(a[i], a[j]);
+    }
+    // the twiddles of the stage with half length h sit at w[h..2h), each with Shoup's
+    // quotient floor(w * 2^32 / mod) so the butterflies need no division
+    std::vector<std::uint32_t> w(std::max<size_t>(n, 2)), wq(w.size());
+    std::uint64_t root = powmodU64(3, (mod - 1) / n, mod);
+    if(invert)
+        root = powmodU64(root, mod - 2, mod);
+    size_t top = w.size() / 2;
+    w[top] = 1;
+    for(size_t k = 1; k < top; ++k)
+        w[top+k] = (std::uint32_t)(w[top+k-1] * root % mod);
+    for(size_t h = top / 2; h > 0; h >>= 1)
+        for(size_t k = 0; k < h; ++k)
+            w[h+k] = w[2*(h+k)];
+    for(size_t k = 1; k < w.size(); ++k)
+        wq[k] = (std::uint32_t)(((std::uint64_t)w[k] << 32) / mod);
+    for(size_t half = 1; half < n; half <<= 1) {
+        const std::uint32_t *ws = &w[half], *qs = &wq[half];
+        for(size_t i = 0; i < n; i += 2 * half) {
+            std::uint32_t *lo = &a[i], *hi = &a[i+half];
+            for(size_t k = 0; k < half; ++k) {
+                std::uint64_t x = hi[k];
+                std::uint32_t v = (std::uint32_t)(x * ws[k] - ((x * qs[k]) >> 32) * mod);
+                if(v >= mod)
+                    v -= mod;
+                std::uint32_t u = lo[k];
+                lo[k] = u + v >= mod ? u + v - mod : u + v;
+                hi[k] = u >= v ? u - v : u + mod - v;
             }
-        } else {
-            return "0";
         }
-    } else if(str1[0] == '-') {
-        if((((int)str2[str2.length()-1])-48) & 1)
-            return '-' + pow(str1.erase(0, 1), str2);
-        return pow(str1.erase(0, 1), str2);
-    } else if(str2[0] == '-') {
-        if(str1 == "1") {
-            return str1;
+    }
+    if(invert) {
+        std::uint64_t n_inv = powmodU64(n, mod - 2, mod);
+        for(size_t i = 0; i < n; ++i)
+            a[i] = (std::uint32_t)(a[i] * n_inv % mod);
+    }
+}
+
+bigint::limbs bigint::mulNTT(const limbs& a, const limbs& b, unsigned int threads, std::uint64_t base) {
+    // digits of a and b are below base (10^9 or 2^32) and the result is carried in that base
+    static const std::uint32_t primes[3] = {998244353, 167772161, 469762049};
+    bool square = &a == &b;
+    size_t n = 1;
+    while(n < a.size() + b.size())
+        n <<= 1;
+    std::vector<std::uint32_t> conv[3];
+    auto convolve = [&](int p) {
+        std::vector<std::uint32_t> fa(n, 0), fb;
+        for(size_t i = 0; i < a.size(); ++i)
+            fa[i] = a[i] % primes[p];
+        ntt(fa, false, primes[p]);
+        if(square) {
+            for(size_t i = 0; i < n; ++i)
+                fa[i] = (std::uint32_t)((std::uint64_t)fa[i] * fa[i] % primes[p]);
         } else {
-            return "0";
-        }
+            fb.assign(n, 0);
+            for(size_t i = 0; i < b.size(); ++i)
+                fb[i] = b[i] % primes[p];
+            ntt(fb, false, primes[p]);
+            for(size_t i = 0; i < n; ++i)
+                fa[i] = (std::uint32_t)((std::uint64_t)fa[i] * fb[i] % primes[p]);
+        }
+        ntt(fa, true, primes[p]);
+        conv[p].swap(fa);
+    };
+    if(threads > 1) {                                   // the three residue convolutions are independent
+        auto second = std::async(std::launch::async, convolve, 1);
+        auto third = threads > 2 ? std::async(std::launch::async, convolve, 2) : std::future<void>();
+        convolve(0);
+        if(!third.valid())
+            convolve(2);
+        second.get();
+        if(third.valid())
+            third.get();
     } else {
-        std::string init_str1 = str1;
-        while(str2 != "1") {
-            str1 = multiply(str1, init_str1);
-            str2 = subtract(str2, "1");
-        }
-        return str1;
+        for(int p = 0; p < 3; ++p)
+            convolve(p);
+    }
+
+    // Garner: x = r0 + m0*k1 + m0*m1*k2
+    const std::uint64_t m0 = primes[0], m1 = primes[1], m2 = primes[2];
+    const std::uint64_t inv_m0_m1 = powmodU64(m0, m1 - 2, (std::uint32_t)m1);
+    const std::uint64_t inv_m0m1_m2 = powmodU64(m0 * m1 % m2, m2 - 2, (std::uint32_t)m2);
+    limbs res(a.size() + b.size(), 0);
+    unsigned __int128 carry = 0;
+    for(size_t i = 0; i < res.size(); ++i) {
+        std::uint64_t r0 = conv[0][i], r1 = conv[1][i], r2 = conv[2][i];
+        std::uint64_t k1 = (r1 + m1 - r0 % m1) % m1 * inv_m0_m1 % m1;
+        std::uint64_t low = (r0 + m0 * k1) % m2;
+        std::uint64_t k2 = (r2 + m2 - low) % m2 * inv_m0m1_m2 % m2;
+        unsigned __int128 x = (unsigned __int128)r0 + (unsigned __int128)m0 * k1
+                            + (unsigned __int128)(m0 * m1) * k2 + carry;
+        res[i] = (std::uint32_t)(x % base);
+        carry = x / base;
     }
+    trimLimbs(res);
+    return res;
 }
 
+
 /*
         ______________________________________________________
-                        Sqrt Function
+                  Decimal to Binary Conversion Functions
         ______________________________________________________
                       Algorithm Explanation
 
-        Since sqrt of a string(s) has length floor(s/2), if s's length is even and 
-        ceil(s/2) if s's length is odd.
-        So it performs binary Search in that answer's range.
-        
-        Algorithmic Time Complexity : O(log(val. of s)), except divide time complexity
-        Algorithmic Space Complexity : O(s/2);
+        Limbs (base 10^9) are turned into words (base 2^32) by divide and conquer:
+        - a run of at most RADIX_BLOCK limbs is converted by Horner's rule, w = w*10^9 + limb.
+        - a longer run is split at RADIX_BLOCK*2^k limbs, the largest such point below its
+          length, and value = high * 10^(9*RADIX_BLOCK*2^k) + low, both halves converted
+          recursively.
+        - the powers 10^(9*RADIX_BLOCK*2^k) are built once per conversion by repeated
+          squaring and shared by every split at the same level.
+        Word products go through mulNTT carrying in base 2^32 (a coefficient stays below
+        2^22 * 2^64, under the product of its three primes), so each level of the recursion
+        costs O(n log n).
+
+        Algorithmic Time Complexity : O(n log^2 n)
+        Algorithmic Space Complexity : O(n)
 */
 
-std::string bigint::sqrt(std::string s) {                 // returns sqrt(s), numerically
-    if(s[0] == '-')
-        return s;
-    if(s == "0")
-        return "0";
-    unsigned long long int s_len = s.length();
-    std::string ans;
-    std::string mid = "";
-    std::string high, low, square;
-    unsigned long long int ans_len = s_len >> 1;
-    if(s_len & 1) {
-        low = pow("10", std::to_string(ans_len));
-        high = pow("10", std::to_string(ans_len+1));
-    } else {
-        low = pow("10", std::to_string(ans_len-1));
-        high = pow("10", std::to_string(ans_len));
-    }
-    std::string prev;
-    while(1) {
-        mid = divide(add(high, low), "2");
-        square = multiply(mid, mid);
-        if(prev == mid || (maximum(add(square, mid), s) == add(square, mid) && maximum(square, s) == s ) || high == low) {
-            break;
-        }
-        if(maximum(square, s) == s) {
-           low = mid;
-        } else if(maximum(square, s) == square) {
-             high = mid;
-        }
-        prev = mid;
+void bigint::mulWordsSmall(words& a, std::uint32_t m, std::uint32_t add) {   // a = a*m + add
+    std::uint64_t carry = add;
+    for(size_t i = 0; i < a.size(); ++i) {
+        std::uint64_t t = (std::uint64_t)a[i] * m + carry;
+        a[i] = (std::uint32_t)t;
+        carry = t >> 32;
     }
-    ans = mid;
-    return ans;
+    if(carry)
+        a.push_back((std::uint32_t)carry);
+    trimLimbs(a);
 }
 
-
-
-std::string bigint::log2(std::string s) {                 // returns log(s) to base of 2
-    if(s == "0") {
-        // throw new exception(std::out_of_range("log(0) is undefined"));
-        return std::to_string(std::log2(0));
-    }
-    if(s[0] == '-') {
-        // throw new exception(std::out_of_range("log(negative) is not allowed"));
-        return std::to_string(std::log2(-1));
-    }
-    std::string logVal = "-1";
-    while(s != "0") {
-        logVal = add(logVal, "1");
-        s = divide(s, "2");
+void bigint::addWordsAt(words& a, const words& b, size_t shift) { // a += b * 2^(32*shift)
+    if(a.size() < b.size() + shift)
+        a.resize(b.size() + shift, 0);
+    std::uint64_t carry = 0;
+    for(size_t i = 0; i < b.size() || carry; ++i) {
+        if(shift + i == a.size())
+            a.push_back(0);
+        std::uint64_t t = (std::uint64_t)a[shift+i] + carry + (i < b.size() ? b[i] : 0);
+        a[shift+i] = (std::uint32_t)t;
+        carry = t >> 32;
     }
-    return logVal;
+    trimLimbs(a);
 }
 
-std::string bigint::log10(std::string s) {                // returns log(s) to base of 10
-    if(s == "0") {
-        // throw new exception(std::out_of_range("log(0) is undefined"));
-        return std::to_string(std::log2(0));
+bigint::words bigint::mulWords(const words& a, const words& b, unsigned int threads) {
+    if(a.empty() || b.empty())
+        return words();
+    if(std::min(a.size(), b.size()) < WORD_NTT_THRESHOLD) {
+        words res(a.size() + b.size(), 0);
+        for(size_t i = 0; i < a.size(); ++i) {
+            std::uint64_t carry = 0, ai = a[i];
+            for(size_t j = 0; j < b.size(); ++j) {
+                std::uint64_t t = ai * b[j] + res[i+j] + carry;
+                res[i+j] = (std::uint32_t)t;
+                carry = t >> 32;
+            }
+            res[i+b.size()] = (std::uint32_t)carry;
+        }
+        trimLimbs(res);
+        return res;
     }
-    if(s[0] == '-') {
-        // throw new exception(std::out_of_range("log(negative) is not allowed"));
-        return std::to_string(std::log2(-1));
+    if(a.size() + b.size() <= NTT_MAX_LENGTH)
+        return mulNTT(a, b, threads, (std::uint64_t)1 << 32);
+    size_t piece = NTT_MAX_LENGTH / 2;                   // too long for one transform: sum products of pieces
+    words res;
+    for(size_t i = 0; i < a.size(); i += piece) {
+        words pa(a.begin() + i, a.begin() + std::min(a.size(), i + piece));
+        trimLimbs(pa);
+        for(size_t j = 0; j < b.size(); j += piece) {
+            words pb(b.begin() + j, b.begin() + std::min(b.size(), j + piece));
+            trimLimbs(pb);
+            addWordsAt(res, mulWords(pa, pb, threads), i + j);
+        }
     }
-    return std::to_string(s.length() - 1);
+    return res;
 }
 
-std::string bigint::logwithbase(std::string val, std::string base) {
-    return divide(log2(val), log2(base));
+bigint::words bigint::limbsToWords(const limbs& a, unsigned int threads) {   // a converted to base 2^32
+    if(a.size() <= RADIX_BLOCK)
+        return limbsToWordsRange(a.data(), a.size(), std::vector<words>(), 0, threads);
+    std::vector<words> powers(1, words(1, 1));
+    for(size_t i = 0; i < RADIX_BLOCK; ++i)
+        mulWordsSmall(powers[0], LIMB_BASE, 0);
+    while((RADIX_BLOCK << powers.size()) < a.size())
+        powers.push_back(mulWords(powers.back(), powers.back(), threads));
+    return limbsToWordsRange(a.data(), a.size(), powers, powers.size() - 1, threads);
 }
 
-std::string bigint::antilog2(std::string s) {
-    return pow("2", s);
+bigint::words bigint::limbsToWordsRange(const std::uint32_t* a, size_t n, const std::vector<words>& powers, size_t level, unsigned int threads) {
+    // limbs a[0..n) in base 2^32, powers[k] = 10^(9*RADIX_BLOCK*2^k)
+    if(n <= RADIX_BLOCK) {
+        words w;
+        for(size_t i = n; i-- > 0; )
+            mulWordsSmall(w, LIMB_BASE, a[i]);
+        return w;
+    }
+    while(level > 0 && (RADIX_BLOCK << level) >= n)
+        level--;
+    size_t split = RADIX_BLOCK << level, next = level > 0 ? level - 1 : 0;
+    words low, high;
+    if(threads > 1) {                                   // the halves are independent
+        auto pending = std::async(std::launch::async, limbsToWordsRange, a, split, std::cref(powers), next, threads / 2);
+        high = limbsToWordsRange(a + split, n - split, powers, next, threads - threads / 2);
+        low = pending.get();
+    } else {
+        low = limbsToWordsRange(a, split, powers, next, 1);
+        high = limbsToWordsRange(a + split, n - split, powers, next, 1);
+    }
+    words res = mulWords(high, powers[level], threads);
+    addWordsAt(res, low, 0);
+    return res;
 }
 
-std::string bigint::antilog10(std::string s) {
-    return pow("10", s);
+size_t bigint::bitLengthWords(const words& a) {                  // number of significant bits, 0 for zero
+    if(a.empty())
+        return 0;
+    return 32 * a.size() - __builtin_clz(a.back());
 }
 
-void bigint::swap(std::string& str1, std::string& str2) {
-    std::string s;
-    s = str1;
-    str1 = str2;
-    str2 = s;
+
+/*
+        ______________________________________________________
+                  Binary to Decimal Conversion Functions
+        ______________________________________________________
+                      Algorithm Explanation
+
+        Words (base 2^32) are turned into limbs (base 10^9) by the mirror image of
+        limbsToWords, doing the arithmetic in the target base so no division is needed:
+        - a run of at most RADIX_BLOCK words is converted by Horner's rule, l = l*2^32 + word.
+        - a longer run is split at RADIX_BLOCK*2^k words and
+          value = high * 2^(32*RADIX_BLOCK*2^k) + low, the halves converted recursively.
+        - the powers 2^(32*RADIX_BLOCK*2^k), held as limbs, are squared once per conversion
+          with mulLimbs and shared by every split on the same level.
+        fromLimbs then writes the digits into a string sized up front.
+
+        Algorithmic Time Complexity : O(n log^2 n)
+        Algorithmic Space Complexity : O(n)
+*/
+
+bigint::limbs bigint::wordsToLimbs(const words& a, unsigned int threads) {    // a converted to base 10^9
+    if(a.size() <= RADIX_BLOCK)
+        return wordsToLimbsRange(a.data(), a.size(), std::vector<limbs>(), 0, threads);
+    std::vector<limbs> powers(1, limbs(1, 1));
+    for(size_t i = 0; i < 2 * RADIX_BLOCK; ++i)
+        mulLimbsSmall(powers[0], 1u << 16);
+    while((RADIX_BLOCK << powers.size()) < a.size())
+        powers.push_back(mulLimbs(powers.back(), powers.back(), threads));
+    return wordsToLimbsRange(a.data(), a.size(), powers, powers.size() - 1, threads);
 }
 
-std::string bigint::reverse(std::string s) {          // reverses the string number, example: "7875" => "5787"
-    bool fl = false;
-    if(s[0] == '-') {
-        s.erase(0, 1);
-        fl = true;
+bigint::limbs bigint::wordsToLimbsRange(const std::uint32_t* a, size_t n, const std::vector<limbs>& powers, size_t level, unsigned int threads) {
+    // words a[0..n) in base 10^9, powers[k] = 2^(32*RADIX_BLOCK*2^k)
+    if(n <= RADIX_BLOCK) {
+        limbs l;
+        for(size_t i = n; i-- > 0; ) {
+            mulLimbsSmall(l, 1u << 16);
+            mulLimbsSmall(l, 1u << 16);
+            addLimbsAt(l, limbsFromU64(a[i]), 0);
+        }
+        return l;
     }
-    unsigned long long int beg = 0, end = s.length() - 1;
-    char ch;
-    while(beg < end) {
-        ch = s[beg];
-        s[beg] = s[end];
-        s[end] = ch;
-        beg++;
-        end--;
+    while(level > 0 && (RADIX_BLOCK << level) >= n)
+        level--;
+    size_t split = RADIX_BLOCK << level, next = level > 0 ? level - 1 : 0;
+    limbs low, high;
+    if(threads > 1) {                                   // the halves are independent
+        auto pending = std::async(std::launch::async, wordsToLimbsRange, a, split, std::cref(powers), next, threads / 2);
+        high = wordsToLimbsRange(a + split, n - split, powers, next, threads - threads / 2);
+        low = pending.get();
+    } else {
+        low = wordsToLimbsRange(a, split, powers, next, 1);
+        high = wordsToLimbsRange(a + split, n - split, powers, next, 1);
     }
-    if(fl)
-        s = '-' + s;
-    return s;
+    limbs res = mulLimbs(high, powers[level], threads);
+    addLimbsAt(res, low, 0);
+    return res;
 }
 
+
 /*
         ______________________________________________________
-                        gcd Function
+                      Bitwise and Shift Functions
         ______________________________________________________
                       Algorithm Explanation
 
-        It performs euclid method for finding greates common divisor
-        
-        Algorithmic Time Complexity : O(log(val. of str2)), except mod time complexity
-        Algorithmic Space Complexity : O(log(str2)) in stack;
+        Values are sign and magnitude; the bit operations act as if both operands were
+        infinitely sign extended two's complement numbers:
+        - both magnitudes are converted to words and padded to one word more than the
+          longer, and a negative one is replaced by its two's complement 2^(32L) - m.
+        - the operation runs word by word in a plain loop the compiler vectorizes.
+        - the top bit of the result gives its sign, and a negative result is negated back
+          to a magnitude.
+        Shifts move the magnitude by whole words and a bit offset. A right shift of a
+        negative value rounds toward negative infinity: the magnitude is rounded up when
+        any 1 bit is shifted out, matching an arithmetic shift in two's complement.
+
+        Algorithmic Time Complexity : O(n) on words, plus the decimal conversions
+        Algorithmic Space Complexity : O(n)
 */
 
-std::string bigint::gcd(std::string str1, std::string str2) {
-    if(is_strictlyMaximum(str2, str1))
-        swap(str1, str2);
-    std::string temp = "";
-    while(is_strictlyMaximum(str2, "0")) {
-        temp = mod(str1, str2);
-        str1 = str2;
-        str2 = temp;
+void bigint::negateWords(words& w) {                              // w = 2^(32*w.size()) - w
+    std::uint32_t carry = 1;
+    for(size_t i = 0; i < w.size(); ++i) {
+        std::uint32_t x = ~w[i] + carry;
+        carry = carry && x == 0;
+        w[i] = x;
     }
-    return str1;
 }
 
-std::string bigint::lcm(std::string str1, std::string str2) {      // return lcm of both str1 and str2
-    return divide(multiply(str1, str2), gcd(str1, str2));
+void bigint::decrementWords(words& w) {                          // w -= 1, requires w > 0
+    for(size_t i = 0; w[i]-- == 0; ++i)
+        ;
+    trimLimbs(w);
 }
 
-std::string bigint::fact(std::string s) {                     // returns the factorial of string s, numerically
-    if(s[0] == '-') {
-        throw std::runtime_error("Factorial of Negative Integer is not defined.");
-    }
-    if(s == "0")
-        return "1";
-    std::string ans = "1";
-    while(s != "0") {
-        ans = multiply(ans, s);
-        s = subtract(s, "1");
-    }
-    return ans;
+std::uint32_t bigint::lowNineBits(const std::string& s) {       // |s| mod 2^9, read off the last 9 digits as 2^9 divides 10^9
+    std::uint32_t v = 0;
+    size_t beg = s[0] == '-';
+    for(size_t i = s.length() > beg + 9 ? s.length() - 9 : beg; i < s.length(); ++i)
+        v = v*10 + (s[i] - '0');
+    return v & 511;
 }
 
-bool bigint::isPalindrome(std::string s) {                  // checks if the Integer as string, s is Palindrome no. or not
-    if(s[0] == '-')
-        s.erase(0, 1);
-    unsigned long long int beg = 0, end = s.length() - 1;
-    while(beg < end) {
-        if(s[beg] != s[end])
-            return false;
-        beg++;
-        end--;
+std::string bigint::bitwise(const std::string& str1, const std::string& str2, char op) {
+    words a = limbsToWords(toLimbs(str1)), b = limbsToWords(toLimbs(str2));
+    bool neg1 = str1[0] == '-' && !a.empty(), neg2 = str2[0] == '-' && !b.empty();
+    size_t len = std::max(a.size(), b.size()) + 1;
+    a.resize(len, 0);
+    b.resize(len, 0);
+    if(neg1)
+        negateWords(a);
+    if(neg2)
+        negateWords(b);
+    std::uint32_t *x = a.data();
+    const std::uint32_t *y = b.data();
+    if(op == '&') {
+        for(size_t i = 0; i < len; ++i)
+            x[i] &= y[i];
+    } else if(op == '|') {
+        for(size_t i = 0; i < len; ++i)
+            x[i] |= y[i];
+    } else {
+        for(size_t i = 0; i < len; ++i)
+            x[i] ^= y[i];
     }
-    return true;
+    bool negative = a.back() >> 31;
+    if(negative)
+        negateWords(a);
+    trimLimbs(a);
+    return fromLimbs(wordsToLimbs(a), negative);
 }
 
-bool bigint::isPrime(std::string s) {                // checks if the String as Number is prime or not
-    if(maximum(s, "2") != s)
+std::string bigint::shiftLeft(const std::string& s, long long k) {    // s * 2^k
+    if(k < 0)
+        throw std::invalid_argument("Negative shift count.");
+    words w = limbsToWords(toLimbs(s));
+    if(w.empty())
+        return "0";
+    size_t whole = (size_t)k / 32;
+    int bits = (int)(k % 32);
+    words r(w.size() + whole + 1, 0);
+    if(bits == 0) {
+        std::copy(w.begin(), w.end(), r.begin() + whole);
+    } else {
+        for(size_t i = 0; i < w.size(); ++i) {
+            r[i + whole] |= w[i] << bits;
+            r[i + whole + 1] = w[i] >> (32 - bits);
+        }
+    }
+    trimLimbs(r);
+    return fromLimbs(wordsToLimbs(r, threadCount()), s[0] == '-');
+}
+
+std::string bigint::shiftRight(const std::string& s, long long k) {   // floor(s / 2^k)
+    if(k < 0)
+        throw std::invalid_argument("Negative shift count.");
+    words w = limbsToWords(toLimbs(s));
+    bool negative = s[0] == '-' && !w.empty();
+    size_t whole = (size_t)k / 32;
+    int bits = (int)(k % 32);
+    if(whole >= w.size())
+        return negative ? "-1" : "0";
+    bool lost = false;                                          // a 1 bit was shifted out
+    for(size_t i = 0; i < whole && !lost; ++i)
+        lost = w[i] != 0;
+    if(bits)
+        lost = lost || (w[whole] & ((1u << bits) - 1)) != 0;
+    words r(w.size() - whole);
+    for(size_t i = 0; i < r.size(); ++i) {
+        std::uint64_t pair = w[i + whole] | (i + whole + 1 < w.size() ? (std::uint64_t)w[i + whole + 1] << 32 : 0);
+        r[i] = (std::uint32_t)(pair >> bits);
+    }
+    trimLimbs(r);
+    if(negative && lost)
+        addWordsAt(r, words(1, 1), 0);
+    return fromLimbs(wordsToLimbs(r, threadCount()), negative && !r.empty());
+}
+
+/*
+        ______________________________________________________
+                     Radix Conversion Functions
+        ______________________________________________________
+                      Algorithm Explanation
+
+        Text in a base b = 2^s (2, 4, 8, 16, 32) is bit repacking: digit i occupies bits
+        [s*i, s*i + s) of the words, so both directions are a single linear pass.
+        Any other base b other than 10 is read and written a chunk at a time, where a chunk
+        is the k digits with b^k the largest power of b that fits a word:
+        - reading: w = w * b^k + chunk, on words.
+        - writing: the words are divided by b^k, each remainder giving k digits from the
+          least significant end.
+        The decimal side goes through limbsToWords and wordsToLimbs.
+
+        Algorithmic Time Complexity : O(n) for 2^s, O(n^2 / k) otherwise
+        Algorithmic Space Complexity : O(n)
+*/
+
+int bigint::digitValue(char c) {                                     // value of a base 36 digit, 36 if c is not one
+    if(c >= '0' && c <= '9')
+        return c - '0';
+    if(c >= 'a' && c <= 'z')
+        return c - 'a' + 10;
+    if(c >= 'A' && c <= 'Z')
+        return c - 'A' + 10;
+    return 36;
+}
+
+std::uint32_t bigint::divWordsSmall(words& a, std::uint32_t m) {     // a /= m, returns a % m
+    std::uint64_t rem = 0;
+    for(size_t i = a.size(); i-- > 0; ) {
+        std::uint64_t cur = rem << 32 | a[i];
+        a[i] = (std::uint32_t)(cur / m);
+        rem = cur % m;
+    }
+    trimLimbs(a);
+    return (std::uint32_t)rem;
+}
+
+bigint::words bigint::digitsToWords(const char* p, size_t n, int base) {   // p[0..n), all valid digits of base
+    if((base & (base - 1)) == 0) {                                   // 2^bits: the digits are packed straight into words
+        int bits = __builtin_ctz(base);
+        words w((n * bits + 31) / 32, 0);
+        size_t pos = 0;
+        for(size_t i = n; i-- > 0; pos += bits) {
+            std::uint64_t d = (std::uint64_t)digitValue(p[i]) << (pos % 32);
+            w[pos/32] |= (std::uint32_t)d;
+            if(d >> 32)
+                w[pos/32 + 1] |= (std::uint32_t)(d >> 32);
+        }
+        trimLimbs(w);
+        return w;
+    }
+    std::uint32_t chunkPower = base, chunk = 1;
+    while((std::uint64_t)chunkPower * base <= 0xFFFFFFFFu) {
+        chunkPower *= base;
+        chunk++;
+    }
+    words w;
+    w.reserve(n / chunk + 1);
+    size_t first = n % chunk == 0 ? chunk : n % chunk;             // the leading, possibly short, chunk
+    for(size_t i = 0; i < n; ) {
+        size_t len = i == 0 ? first : chunk;
+        std::uint32_t value = 0, scale = 1;
+        for(size_t j = 0; j < len; ++j) {
+            value = value * base + digitValue(p[i+j]);
+            scale *= base;
+        }
+        mulWordsSmall(w, scale, value);
+        i += len;
+    }
+    return w;
+}
+
+std::string bigint::wordsToDigits(words w, int base) {              // digits of w in base, most significant first
+    static const char alphabet[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+    if((base & (base - 1)) == 0) {                                   // 2^bits: each digit is read off its bit field
+        int bits = __builtin_ctz(base);
+        size_t count = std::max<size_t>((bitLengthWords(w) + bits - 1) / bits, 1);
+        std::string s(count, '0');
+        for(size_t k = 0, pos = 0; k < count && !w.empty(); ++k, pos += bits) {
+            std::uint64_t field = w[pos/32] >> (pos % 32);
+            if(pos % 32 + bits > 32 && pos/32 + 1 < w.size())
+                field |= (std::uint64_t)w[pos/32 + 1] << (32 - pos % 32);
+            s[count-1-k] = alphabet[field & (base - 1)];
+        }
+        return s;
+    }
+    std::uint32_t chunkPower = base, chunk = 1;
+    while((std::uint64_t)chunkPower * base <= 0xFFFFFFFFu) {
+        chunkPower *= base;
+        chunk++;
+    }
+    std::string s;
+    s.reserve(bitLengthWords(w) + 1);
+    while(!w.empty()) {
+        std::uint32_t rem = divWordsSmall(w, chunkPower);
+        for(std::uint32_t j = 0; j < chunk && (rem || !w.empty()); ++j) {
+            s.push_back(alphabet[rem % base]);
+            rem /= base;
+        }
+    }
+    if(s.empty())
+        s = "0";
+    std::reverse(s.begin(), s.end());
+    return s;
+}
+
+
+/*
+        ______________________________________________________
+                      Limb Division Function
+        ______________________________________________________
+                      Algorithm Explanation
+
+        Knuth's algorithm D in base 10^9. Both operands are scaled by f = 10^9 / (top + 1)
+        so the divisor's top limb is at least 10^9 / 2; then every quotient limb estimated
+        from the top two limbs of the running remainder is at most two too large, and the
+        rare overshoot is fixed by adding the divisor back once.
+
+        Algorithmic Time Complexity : O((n-m)*m)
+        Algorithmic Space Complexity : O(n)
+        where n ans m are the limb lengths of dividend and divisor.
+*/
+
+void bigint::divmodLimbs(const limbs& a, const limbs& b, limbs& q, limbs& r) {   // q = a / b, r = a % b, b != 0
+    if(compareLimbs(a, b) < 0) {
+        q.clear();
+        r = a;
+        return;
+    }
+    if(b.size() == 1) {
+        q = a;
+        r = limbsFromU64(divLimbsSmall(q, b[0]));
+        return;
+    }
+    std::uint32_t f = LIMB_BASE / (b.back() + 1);
+    limbs u = a, v = b;
+    mulLimbsSmall(u, f);
+    mulLimbsSmall(v, f);
+    size_t n = v.size(), m = a.size() - n;
+    u.resize(a.size() + 1, 0);
+    q.assign(m + 1, 0);
+    const std::uint64_t vtop = v[n-1], vnext = v[n-2];
+    for(size_t j = m + 1; j-- > 0; ) {
+        std::uint64_t num = (std::uint64_t)u[j+n] * LIMB_BASE + u[j+n-1];
+        std::uint64_t qhat = num / vtop, rhat = num % vtop;
+        while(qhat >= LIMB_BASE || qhat * vnext > rhat * LIMB_BASE + u[j+n-2]) {
+            qhat--;
+            rhat += vtop;
+            if(rhat >= LIMB_BASE)
+                break;
+        }
+        std::uint64_t carry = 0;
+        long long int borrow = 0;
+        for(size_t i = 0; i < n; ++i) {
+            std::uint64_t p = qhat * v[i] + carry;
+            carry = p / LIMB_BASE;
+            long long int t = (long long int)u[i+j] - (long long int)(p % LIMB_BASE) - borrow;
+            borrow = t < 0;
+            u[i+j] = (std::uint32_t)(t < 0 ? t + LIMB_BASE : t);
+        }
+        long long int top = (long long int)u[j+n] - (long long int)carry - borrow;
+        if(top < 0) {                                   // qhat was one too large: add the divisor back
+            qhat--;
+            std::uint32_t c = 0;
+            for(size_t i = 0; i < n; ++i) {
+                std::uint32_t t = u[i+j] + v[i] + c;
+                c = t >= LIMB_BASE;
+                u[i+j] = c ? t - LIMB_BASE : t;
+            }
+            top += c;
+        }
+        u[j+n] = (std::uint32_t)top;
+        q[j] = (std::uint32_t)qhat;
+    }
+    trimLimbs(q);
+    u.resize(n);
+    trimLimbs(u);
+    divLimbsSmall(u, f);
+    r.swap(u);
+}
+
+bigint::limbs bigint::modLimbs(const limbs& a, const limbs& m) {
+    limbs q, r;
+    divmodLimbs(a, m, q, r);
+    return r;
+}
+
+bool bigint::limbsToU64(const limbs& a, std::uint64_t& v) {     // false if a does not fit in 64 bits
+    unsigned __int128 acc = 0;
+    if(a.size() > 3)
+        return false;
+    for(size_t i = a.size(); i-- > 0; )
+        acc = acc * LIMB_BASE + a[i];
+    if(acc > std::numeric_limits<std::uint64_t>::max())
         return false;
-    std::string sqrt = bigint::sqrt(s);
-    std::string i = "";
-    for(i = "2"; is_maximum(sqrt, i); i = add(i, "1")) {
-        if(mod(s, i) == "0")
+    v = (std::uint64_t)acc;
+    return true;
+}
+
+std::vector<unsigned char> bigint::limbsToBits(limbs a) {      // binary digits of a, least significant first
+    words w = limbsToWords(a);
+    std::vector<unsigned char> bits(bitLengthWords(w));
+    for(size_t i = 0; i < bits.size(); ++i)
+        bits[i] = (w[i/32] >> (i % 32)) & 1;
+    return bits;
+}
+
+bigint::limbs bigint::powmodLimbs(const limbs& base, const std::vector<unsigned char>& ebits, size_t low, const limbs& m) {
+    // base^(ebits >> low) mod m, left to right with a fixed 4 bit window
+    if(m.size() > 1 && m[0] % 2 != 0 && m[0] % 5 != 0) {
+        montgomery mont(m);
+        return mont.from(powmodMont(mont, mont.to(base), ebits, low));
+    }
+    limbs table[16];
+    table[0] = modLimbs(limbs{1}, m);
+    table[1] = modLimbs(base, m);
+    for(int i = 2; i < 16; ++i)
+        table[i] = modLimbs(mulLimbs(table[i-1], table[1]), m);
+    limbs r = table[0];
+    size_t nbits = ebits.size() > low ? ebits.size() - low : 0;
+    size_t top = (nbits + 3) / 4 * 4;
+    for(size_t w = top; w >= 4; w -= 4) {
+        int digit = 0;
+        for(size_t k = w; k-- > w - 4; ) {
+            digit = digit * 2 + (k < nbits ? ebits[low + k] : 0);
+        }
+        if(w != top) {
+            for(int k = 0; k < 4; ++k)
+                r = modLimbs(mulLimbs(r, r), m);
+        }
+        if(digit)
+            r = modLimbs(mulLimbs(r, table[digit]), m);
+    }
+    return r;
+}
+
+bigint::limbs bigint::isqrtLimbs(const limbs& a) {             // floor(sqrt(a)) by Newton's iteration from above
+    if(a.empty())
+        return limbs();
+    size_t digits = fromLimbs(a, false).length();
+    limbs x = toLimbs("1" + std::string((digits + 1) / 2, '0'));
+    while(true) {
+        limbs q, r;
+        divmodLimbs(a, x, q, r);
+        addLimbsAt(q, x, 0);
+        divLimbsSmall(q, 2);
+        if(compareLimbs(q, x) >= 0)
+            return x;
+        x.swap(q);
+    }
+}
+
+std::uint32_t bigint::inverseModBase(std::uint32_t a) {        // a^-1 mod 10^9 for a coprime to 10, extended Euclid
+    long long int old_r = a, r = LIMB_BASE, old_s = 1, s = 0;
+    while(r != 0) {
+        long long int q = old_r / r, t;
+        t = old_r - q*r;  old_r = r;  r = t;
+        t = old_s - q*s;  old_s = s;  s = t;
+    }
+    return (std::uint32_t)((old_s % (long long int)LIMB_BASE + LIMB_BASE) % LIMB_BASE);
+}
+
+bigint::limbs bigint::gcdLimbs(limbs a, limbs b) {             // Euclid's algorithm on limbs
+    while(!b.empty()) {
+        limbs r = modLimbs(a, b);
+        a.swap(b);
+        b.swap(r);
+    }
+    return a;
+}
+
+bigint::limbs bigint::invmodLimbs(const limbs& a, const limbs& m, limbs& inv) {   // returns g = gcd(a, m), inv = a^-1 mod m when g == 1
+    // Extended Euclid tracking only the coefficient of a, as a magnitude and a sign.
+    limbs old_r = modLimbs(a, m), r = m;
+    limbs old_s = {1}, s;
+    bool old_neg = false, neg = false;
+    while(!r.empty()) {
+        limbs q, rem;
+        divmodLimbs(old_r, r, q, rem);
+        old_r.swap(r);
+        r.swap(rem);
+        limbs qs = mulLimbs(q, s);                      // next = old_s - q*s
+        limbs next;
+        bool next_neg;
+        if(old_neg != neg || qs.empty()) {
+            next = old_s;
+            addLimbsAt(next, qs, 0);
+            next_neg = old_s.empty() ? !neg : old_neg;
+        } else if(compareLimbs(old_s, qs) >= 0) {
+            next = old_s;
+            subLimbs(next, qs);
+            next_neg = old_neg;
+        } else {
+            next = qs;
+            subLimbs(next, old_s);
+            next_neg = !old_neg;
+        }
+        old_s.swap(s);
+        old_neg = neg;
+        s.swap(next);
+        neg = next_neg;
+    }
+    inv = modLimbs(old_s, m);
+    if(old_neg && !inv.empty()) {
+        limbs t = m;
+        subLimbs(t, inv);
+        inv.swap(t);
+    }
+    return old_r;
+}
+
+/*
+        ______________________________________________________
+                      Montgomery Arithmetic
+        ______________________________________________________
+                      Algorithm Explanation
+
+        For a modulus n coprime to the limb base, residues are stored as a*R mod n with
+        R = 10^(9k), k = limbs of n. A product a*b*R^-1 mod n is computed limb by limb
+        (coarsely integrated operand scanning): after adding a[i]*b, a multiple m*n with
+        m = t[0] * (-n^-1) mod 10^9 is added so the lowest limb becomes zero and can be
+        shifted out. No long division is needed, which makes repeated modular products
+        (powmod, primality tests, factoring) much cheaper.
+
+        Algorithmic Time Complexity : O(k^2) per product
+        Algorithmic Space Complexity : O(k)
+*/
+
+bigint::montgomery::montgomery(const limbs& modulus) : n(modulus), k(modulus.size()) {
+    ninv = (LIMB_BASE - inverseModBase(n[0])) % LIMB_BASE;
+    limbs R(k + 1, 0), R2(2*k + 1, 0);
+    R[k] = 1;
+    R2[2*k] = 1;
+    one = modLimbs(R, n);
+    r2 = modLimbs(R2, n);
+    one.resize(k, 0);
+    r2.resize(k, 0);
+}
+
+void bigint::montgomery::mul(const limbs& a, const limbs& b, limbs& out) const {
+    limbs t;
+    if(k < KARATSUBA_THRESHOLD) {
+        t = mulSchool(a.data(), k, b.data(), k);
+    } else if(&a == &b) {
+        limbs x = a;
+        trimLimbs(x);
+        t = mulLimbs(x, x);
+    } else {
+        limbs x = a, y = b;
+        trimLimbs(x);
+        trimLimbs(y);
+        t = mulLimbs(x, y);
+    }
+    // REDC: add m*n*10^(9i) to clear limb i, for i < k, then drop the k low limbs
+    t.resize(2*k + 1, 0);
+    for(size_t i = 0; i < k; ++i) {
+        std::uint64_t m = t[i] * ninv % LIMB_BASE, carry = 0, cur;
+        if(m == 0)
+            continue;
+        for(size_t j = 0; j < k; ++j) {
+            cur = t[i+j] + m * n[j] + carry;
+            t[i+j] = (std::uint32_t)(cur % LIMB_BASE);
+            carry = cur / LIMB_BASE;
+        }
+        for(size_t j = i + k; carry; ++j) {
+            cur = t[j] + carry;
+            t[j] = (std::uint32_t)(cur % LIMB_BASE);
+            carry = cur / LIMB_BASE;
+        }
+    }
+    bool geq = t[2*k] != 0;
+    if(!geq) {
+        geq = true;
+        for(size_t i = k; i-- > 0; ) {
+            if(t[k+i] != n[i]) {
+                geq = t[k+i] > n[i];
+                break;
+            }
+        }
+    }
+    if(geq) {
+        std::uint32_t borrow = 0;
+        for(size_t i = 0; i < k; ++i) {
+            std::uint32_t sub = n[i] + borrow;
+            borrow = t[k+i] < sub;
+            t[k+i] = borrow ? t[k+i] + LIMB_BASE - sub : t[k+i] - sub;
+        }
+    }
+    out.assign(t.begin() + k, t.begin() + 2*k);
+}
+
+void bigint::montgomery::add(limbs& a, const limbs& b) const {  // a = a + b mod n
+    std::uint32_t carry = 0;
+    for(size_t i = 0; i < k; ++i) {
+        std::uint32_t t = a[i] + b[i] + carry;
+        carry = t >= LIMB_BASE;
+        a[i] = carry ? t - LIMB_BASE : t;
+    }
+    bool geq = carry != 0;
+    if(!geq) {
+        geq = true;
+        for(size_t i = k; i-- > 0; ) {
+            if(a[i] != n[i]) {
+                geq = a[i] > n[i];
+                break;
+            }
+        }
+    }
+    if(geq) {
+        std::uint32_t borrow = 0;
+        for(size_t i = 0; i < k; ++i) {
+            std::uint32_t sub = n[i] + borrow;
+            borrow = a[i] < sub;
+            a[i] = borrow ? a[i] + LIMB_BASE - sub : a[i] - sub;
+        }
+    }
+}
+
+void bigint::montgomery::sub(limbs& a, const limbs& b) const {  // a = a - b mod n
+    std::uint32_t borrow = 0;
+    for(size_t i = 0; i < k; ++i) {
+        std::uint32_t sub = b[i] + borrow;
+        borrow = a[i] < sub;
+        a[i] = borrow ? a[i] + LIMB_BASE - sub : a[i] - sub;
+    }
+    if(borrow) {
+        std::uint32_t carry = 0;
+        for(size_t i = 0; i < k; ++i) {
+            std::uint32_t t = a[i] + n[i] + carry;
+            carry = t >= LIMB_BASE;
+            a[i] = carry ? t - LIMB_BASE : t;
+        }
+    }
+}
+
+bigint::limbs bigint::montgomery::to(const limbs& a) const {    // a*R mod n
+    limbs x = modLimbs(a, n);
+    x.resize(k, 0);
+    return mul(x, r2);
+}
+
+bigint::limbs bigint::montgomery::from(const limbs& a) const {  // a/R mod n, trimmed
+    limbs unit(k, 0);
+    unit[0] = 1;
+    limbs x = mul(a, unit);
+    trimLimbs(x);
+    return x;
+}
+
+bool bigint::montgomery::isZero(const limbs& a) const {
+    for(std::uint32_t limb : a) {
+        if(limb != 0)
             return false;
     }
     return true;
 }
 
+bigint::limbs bigint::powmodMont(const montgomery& mont, const limbs& base, const std::vector<unsigned char>& ebits, size_t low) {
+    // base^(ebits >> low) in Montgomery form, fixed 4 bit window
+    limbs table[16];
+    table[0] = mont.one;
+    table[1] = base;
+    for(int i = 2; i < 16; ++i)
+        table[i] = mont.mul(table[i-1], base);
+    limbs r = mont.one;
+    size_t nbits = ebits.size() > low ? ebits.size() - low : 0;
+    size_t top = (nbits + 3) / 4 * 4;
+    for(size_t w = top; w >= 4; w -= 4) {
+        int digit = 0;
+        for(size_t i = w; i-- > w - 4; )
+            digit = digit * 2 + (i < nbits ? ebits[low + i] : 0);
+        if(w != top) {
+            for(int i = 0; i < 4; ++i)
+                mont.mul(r, r, r);
+        }
+        if(digit)
+            mont.mul(r, table[digit], r);
+    }
+    return r;
+}
+
+bigint::limbs bigint::powmodMontU64(const montgomery& mont, const limbs& base, std::uint64_t e) {   // base^e, Montgomery form
+    limbs r = mont.one, x = base;
+    while(e) {
+        if(e & 1)
+            mont.mul(r, x, r);
+        e >>= 1;
+        if(e)
+            mont.mul(x, x, x);
+    }
+    return r;
+}
+
+//____________________________________________________________________________________________
+
+
+
+std::string bigint::abs(std::string s) {                          // returns absolute value of string
+    if(s[0] == '-')
+        s.erase(0, 1);
+    return s;
+}
+
+
+/*
+        ______________________________________________________
+                        Power Function
+        ______________________________________________________
+                      Algorithm Explanation
+
+        It multiplies str1, str2 times and updates the str1 value
+        
+        Algorithmic Time Complexity : O(m), except multiplication time complexity
+        Algorithmic Space Complexity : O(1)
+        where n ans m are the lengths of respective strings(Integers) provided.
+*/
+
+std::string bigint::pow(std::string str1, std::string str2) {                  // returns str1^str2, ^ -> power, numerically
+    if(str2 == "0") {
+        return "1";
+    } else if(str1 == "0") {
+        if(str2[0] == '-')
+            return std::to_string((long long int)std::pow(0, -5));
+        return "0";
+    } else if(str1[0] == '-' && str2[0] == '-') {
+        if(str1 == "-1" && str2 == "-1") {
+            return "-1";
+        } else if(str1 == "-1") {
+            if((((int)str2[str2.length()-1])-48) & 1) {                
+                return "-1";
+            } else {
+                return "1";
+            }
+        } else {
+            return "0";
+        }
+    } else if(str1[0] == '-') {
+        if((((int)str2[str2.length()-1])-48) & 1)
+            return '-' + pow(str1.erase(0, 1), str2);
+        return pow(str1.erase(0, 1), str2);
+    } else if(str2[0] == '-') {
+        if(str1 == "1") {
+            return str1;
+        } else {
+            return "0";
+        }
+    } else {
+        std::string init_str1 = str1;
+        while(compareSmall(str2, 1) != 0) {
+            str1 = multiply(str1, init_str1);
+            str2 = subtract(str2, "1");
+        }
+        return str1;
+    }
+}
+
+/*
+        ______________________________________________________
+                        Sqrt Function
+        ______________________________________________________
+                      Algorithm Explanation
+
+        Since sqrt of a string(s) has length floor(s/2), if s's length is even and 
+        ceil(s/2) if s's length is odd.
+        So it performs binary Search in that answer's range.
+        
+        Algorithmic Time Complexity : O(log(val. of s)), except divide time complexity
+        Algorithmic Space Complexity : O(s/2);
+*/
+
+std::string bigint::sqrt(std::string s) {                 // returns sqrt(s), numerically
+    if(s[0] == '-')
+        return s;
+    if(s == "0")
+        return "0";
+    unsigned long long int s_len = s.length();
+    std::string ans;
+    std::string mid = "";
+    std::string high, low, square;
+    unsigned long long int ans_len = s_len >> 1;
+    if(s_len & 1) {
+        low = pow("10", std::to_string(ans_len));
+        high = pow("10", std::to_string(ans_len+1));
+    } else {
+        low = pow("10", std::to_string(ans_len-1));
+        high = pow("10", std::to_string(ans_len));
+    }
+    std::string prev;
+    while(1) {
+        mid = divide(add(high, low), "2");
+        square = multiply(mid, mid);
+        if(prev == mid || (is_maximum(add(square, mid), s) && is_maximum(s, square)) || high == low) {
+            break;
+        }
+        if(is_maximum(s, square)) {
+           low = mid;
+        } else {
+             high = mid;
+        }
+        prev = mid;
+    }
+    ans = mid;
+    return ans;
+}
+
+
+
+std::string bigint::log2(std::string s) {                 // returns log(s) to base of 2
+    if(s == "0") {
+        // throw new exception(std::out_of_range("log(0) is undefined"));
+        return std::to_string(std::log2(0));
+    }
+    if(s[0] == '-') {
+        // throw new exception(std::out_of_range("log(negative) is not allowed"));
+        return std::to_string(std::log2(-1));
+    }
+    return std::to_string(bitLengthWords(limbsToWords(toLimbs(s), threadCount())) - 1);
+}
+
+std::string bigint::log10(std::string s) {                // returns log(s) to base of 10
+    if(s == "0") {
+        // throw new exception(std::out_of_range("log(0) is undefined"));
+        return std::to_string(std::log2(0));
+    }
+    if(s[0] == '-') {
+        // throw new exception(std::out_of_range("log(negative) is not allowed"));
+        return std::to_string(std::log2(-1));
+    }
+    return std::to_string(s.length() - 1);
+}
+
+std::string bigint::logwithbase(std::string val, std::string base) {
+    return divide(log2(val), log2(base));
+}
+
+std::string bigint::antilog2(std::string s) {               // 2^s, built as a single bit and converted to decimal
+    if(s[0] == '-' || s == "0")
+        return pow("2", s);
+    std::uint32_t n = smallArgument(s, "antilog2 argument is too large.");
+    words w(n / 32 + 1, 0);
+    w.back() = 1u << (n % 32);
+    return fromLimbs(wordsToLimbs(w, threadCount()), false);
+}
+
+std::string bigint::antilog10(std::string s) {
+    return pow("10", s);
+}
+
+void bigint::swap(std::string& str1, std::string& str2) {
+    std::string s;
+    s = str1;
+    str1 = str2;
+    str2 = s;
+}
+
+std::string bigint::reverse(std::string s) {          // reverses the string number, example: "7875" => "5787"
+    bool fl = false;
+    if(s[0] == '-') {
+        s.erase(0, 1);
+        fl = true;
+    }
+    unsigned long long int beg = 0, end = s.length() - 1;
+    char ch;
+    while(beg < end) {
+        ch = s[beg];
+        s[beg] = s[end];
+        s[end] = ch;
+        beg++;
+        end--;
+    }
+    if(fl)
+        s = '-' + s;
+    return s;
+}
+
+/*
+        ______________________________________________________
+                        gcd Function
+        ______________________________________________________
+                      Algorithm Explanation
+
+        It performs euclid method for finding greates common divisor
+        
+        Algorithmic Time Complexity : O(log(val. of str2)), except mod time complexity
+        Algorithmic Space Complexity : O(log(str2)) in stack;
+*/
+
+std::string bigint::gcd(std::string str1, std::string str2) {
+    if(is_strictlyMaximum(str2, str1))
+        swap(str1, str2);
+    std::string temp = "";
+    while(signDecimal(str2) > 0) {
+        temp = mod(str1, str2);
+        str1 = str2;
+        str2 = temp;
+    }
+    return str1;
+}
+
+std::string bigint::lcm(std::string str1, std::string str2) {      // return lcm of both str1 and str2
+    std::string g = gcd(str1, str2);
+    if(g == "0")
+        return "0";
+    return multiply(divexact(str1, g), str2);           // (a / gcd) * b, the full product a*b is never formed
+}
+
+/*
+        ______________________________________________________
+                        Factorial Function
+        ______________________________________________________
+                      Algorithm Explanation
+
+        Prime swing (Luschny): n! = ((n/2)!)^2 * swing(n), where swing(n) = n! / ((n/2)!)^2
+        is a product of prime powers p^e that can be read straight off a sieve:
+          - p > n/2            : e = 1
+          - n/3 < p <= n/2     : e = 0
+          - sqrt(n) < p <= n/3 : e = (n/p) & 1
+          - p <= sqrt(n)       : e = number of odd values among n/p, n/p^2, ...
+        The prime powers are packed into 32 bit words and multiplied together with a
+        balanced product tree, so the big multiplications happen between operands of
+        similar size and use Karatsuba / NTT instead of n growing-by-one-limb steps.
+
+        Algorithmic Time Complexity : O(M(n log n) log n), M = multiplication time complexity
+        Algorithmic Space Complexity : O(n log n) bits
+*/
+
+std::string bigint::fact(std::string s) {                     // returns the factorial of string s, numerically
+    if(s[0] == '-') {
+        throw std::runtime_error("Factorial of Negative Integer is not defined.");
+    }
+    s = trim(s);
+    if(s.length() > 10 || std::stoull(s) > std::numeric_limits<std::uint32_t>::max())
+        throw std::runtime_error("Factorial argument is too large.");
+    std::uint32_t n = (std::uint32_t)std::stoull(s);
+    return fromLimbs(factLimbs(n, sievePrimes(n), threadCount()), false);
+}
+
+/*
+        ______________________________________________________
+                    Fibonacci and Lucas Functions
+        ______________________________________________________
+                      Algorithm Explanation
+
+        Fast doubling carried on the pair (F(k), F(k-1)), two squarings per bit of n:
+          F(2k+1) = 4 F(k)^2 - F(k-1)^2 + 2(-1)^k
+          F(2k-1) = F(k)^2 + F(k-1)^2
+          F(2k)   = F(2k+1) - F(2k-1)
+        The two squarings are independent and run side by side when threads are allowed.
+        L(n) = F(n) + 2 F(n-1) comes from the same pair.
+
+        Algorithmic Time Complexity : O(M(n)), M = multiplication time complexity
+        Algorithmic Space Complexity : O(n) bits
+*/
+
+std::uint32_t bigint::smallArgument(std::string s, const char* what) {     // s as a 32 bit word, throws what if it does not fit
+    if(s.length() > 10 || std::stoull(s) > std::numeric_limits<std::uint32_t>::max())
+        throw std::runtime_error(what);
+    return (std::uint32_t)std::stoull(s);
+}
+
+std::string bigint::fib(std::string s) {                      // returns the s-th Fibonacci number
+    bool neg = s[0] == '-';
+    std::uint32_t n = smallArgument(trim(abs(s)), "Fibonacci argument is too large.");
+    limbs f, f1;
+    fibLimbs(n, f, f1, threadCount());
+    return fromLimbs(f, neg && n % 2 == 0);
+}
+
+std::string bigint::lucas(std::string s) {                    // returns the s-th Lucas number
+    bool neg = s[0] == '-';
+    std::uint32_t n = smallArgument(trim(abs(s)), "Lucas argument is too large.");
+    if(n == 0)
+        return "2";
+    limbs f, f1;
+    fibLimbs(n, f, f1, threadCount());
+    addLimbsAt(f, f1, 0);
+    addLimbsAt(f, f1, 0);
+    return fromLimbs(f, neg && n % 2 == 1);
+}
+
+void bigint::fibLimbs(std::uint32_t n, limbs& f, limbs& f1, unsigned int threads) {   // f = F(n), f1 = F(n-1)
+    f = limbs{1};                                       // k = 1: F(1), F(0)
+    f1.clear();
+    if(n == 0) {
+        f.clear();
+        f1 = limbs{1};                                  // F(-1)
+        return;
+    }
+    std::uint32_t k = 1;
+    int top = 31;
+    while(!((n >> top) & 1))
+        top--;
+    for(int b = top - 1; b >= 0; --b) {
+        limbs a, c;
+        if(threads > 1 && f.size() >= NTT_THRESHOLD) {
+            auto square = std::async(std::launch::async, [&f1, threads] { return mulLimbs(f1, f1, threads / 2); });
+            a = mulLimbs(f, f, threads - threads / 2);
+            c = square.get();
+        } else {
+            a = mulLimbs(f, f);
+            c = mulLimbs(f1, f1);
+        }
+        limbs odd = a;                                  // F(2k+1)
+        mulLimbsSmall(odd, 4);
+        subLimbs(odd, c);
+        if(k % 2 == 0)
+            addLimbsAt(odd, limbs{2}, 0);
+        else
+            subLimbs(odd, limbs{2});
+        addLimbsAt(a, c, 0);                            // F(2k-1)
+        limbs even = odd;                               // F(2k)
+        subLimbs(even, a);
+        if((n >> b) & 1) {
+            f.swap(odd);
+            f1.swap(even);
+            k = 2*k + 1;
+        } else {
+            f.swap(even);
+            f1.swap(a);
+            k = 2*k;
+        }
+    }
+}
+
+/*
+        ______________________________________________________
+                      Binomial Coefficient Function
+        ______________________________________________________
+                      Algorithm Explanation
+
+        C(n, k) = prod p^e over the primes p <= n, where by Legendre / Kummer
+          e = sum over i of floor(n/p^i) - floor(k/p^i) - floor((n-k)/p^i)
+        is the number of carries when adding k and n-k in base p, so p^e <= n. The prime
+        powers are packed into 32 bit words and multiplied with the balanced product tree
+        of the factorial engine; no factorial or division is ever formed.
+        Sieving all of [2, n] only pays off for large k: for k <= BINOMIAL_DIRECT_K the
+        product (n-k+1)...n is formed the same way and divided exactly by k!.
+        For n < 0, C(n, k) = (-1)^k C(k-n-1, k).
+
+        Algorithmic Time Complexity : O(M(b) log b), b = bit length of C(n, k), plus O(n) sieving
+                                      for large k
+        Algorithmic Space Complexity : O(b)
+*/
+
+std::string bigint::binomial(std::string n, std::string k) {  // returns C(n, k), numerically
+    if(k[0] == '-')
+        return "0";
+    bool neg = false;
+    if(n[0] == '-') {                                   // C(n, k) = (-1)^k C(k - n - 1, k)
+        neg = (k.back() - '0') % 2 == 1;
+        n = subtract(subtract(k, n), "1");
+    }
+    if(is_strictlyMaximum(k, n))
+        return "0";
+    std::uint32_t a = smallArgument(trim(n), "Binomial argument is too large.");
+    std::uint32_t b = (std::uint32_t)std::stoull(trim(k));
+    return fromLimbs(binomialLimbs(a, std::min(b, a - b), threadCount()), neg);
+}
+
+bigint::limbs bigint::binomialLimbs(std::uint32_t n, std::uint32_t k, unsigned int threads) {
+    if(k == 0)
+        return limbs{1};
+    if(k <= BINOMIAL_DIRECT_K) {                        // (n-k+1)...n / k!, rather than sieving all of [2, n]
+        // The factors of 2 and 5 are taken out of every term, so the exact division sees a
+        // divisor coprime to 10; what is left of them is a carry count, at most 32 each.
+        std::vector<std::uint32_t> top, bottom;
+        std::uint64_t topWord = 1, bottomWord = 1;
+        int twos = 0, fives = 0;
+        auto pack = [](std::vector<std::uint32_t>& words, std::uint64_t& word, std::uint32_t v, int& e2, int& e5, int sign) {
+            for(; v % 2 == 0; v /= 2)
+                e2 += sign;
+            for(; v % 5 == 0; v /= 5)
+                e5 += sign;
+            if(word * v > std::numeric_limits<std::uint32_t>::max()) {
+                words.push_back((std::uint32_t)word);
+                word = 1;
+            }
+            word *= v;
+        };
+        for(std::uint32_t i = 1; i <= k; ++i) {
+            pack(top, topWord, n - k + i, twos, fives, 1);
+            pack(bottom, bottomWord, i, twos, fives, -1);
+        }
+        top.push_back((std::uint32_t)topWord);
+        bottom.push_back((std::uint32_t)bottomWord);
+        limbs c = divexactLimbs(productTree(top, 0, top.size(), threads), productTree(bottom, 0, bottom.size(), 1));
+        for(; twos > 0; twos -= std::min(twos, 29))
+            mulLimbsSmall(c, 1u << std::min(twos, 29));
+        for(; fives > 0; fives -= std::min(fives, 13)) {
+            std::uint32_t power = 1;
+            for(int j = std::min(fives, 13); j > 0; --j)
+                power *= 5;
+            mulLimbsSmall(c, power);
+        }
+        return c;
+    }
+    std::vector<std::uint32_t> words;
+    std::uint64_t word = 1;
+    for(std::uint32_t p : sievePrimes(n)) {
+        std::uint64_t pe = 1;
+        for(std::uint64_t q = p; q <= n; q *= p) {
+            if(n / q - k / q - (n - k) / q)
+                pe *= p;
+        }
+        if(pe == 1)
+            continue;
+        if(word * pe > std::numeric_limits<std::uint32_t>::max()) {
+            words.push_back((std::uint32_t)word);
+            word = 1;
+        }
+        word *= pe;
+    }
+    words.push_back((std::uint32_t)word);
+    return productTree(words, 0, words.size(), n > 4096 ? threads : 1);
+}
+
+std::atomic<unsigned int>& bigint::threadCount() {         // worker budget for the product trees, 1 by default
+    static std::atomic<unsigned int> count(1);
+    return count;
+}
+
+std::string bigint::productRange(std::string lo, std::string hi) {    // returns lo * (lo+1) * ... * hi, numerically
+    if(is_strictlyMaximum(lo, hi))
+        return "1";
+    if(lo[0] == '-' && hi[0] != '-')
+        return "0";
+    if(lo == "0" || hi == "0")
+        return "0";
+    bool neg = false;
+    if(hi[0] == '-') {                                  // all factors negative: mirror the range
+        std::string t = abs(lo);
+        lo = abs(hi);
+        hi = t;
+        if(hi.length() > 10)
+            throw std::runtime_error("Product range bound is too large.");
+        neg = (hi.back() - lo.back()) % 2 == 0;         // an odd count hi - lo + 1 of negative factors
+    }
+    if(hi.length() > 10 || std::stoull(hi) > std::numeric_limits<std::uint32_t>::max())
+        throw std::runtime_error("Product range bound is too large.");
+    std::uint32_t a = (std::uint32_t)std::stoull(lo), b = (std::uint32_t)std::stoull(hi);
+    std::vector<std::uint32_t> words;
+    std::uint64_t word = 1;
+    for(std::uint64_t i = a; i <= b; ++i) {
+        if(word * i > std::numeric_limits<std::uint32_t>::max()) {
+            words.push_back((std::uint32_t)word);
+            word = 1;
+        }
+        word *= i;
+    }
+    words.push_back((std::uint32_t)word);
+    return fromLimbs(productTree(words, 0, words.size(), threadCount()), neg);
+}
+
+std::vector<std::uint32_t> bigint::sievePrimes(std::uint32_t limit) {     // all primes <= limit, sieve of Eratosthenes over odd numbers
+    std::vector<std::uint32_t> primes;
+    if(limit < 2)
+        return primes;
+    primes.push_back(2);
+    std::vector<bool> composite(limit / 2 + 1, false);         // index i stands for 2i+1
+    for(std::uint64_t i = 1; 2*i + 1 <= limit; ++i) {
+        if(composite[i])
+            continue;
+        std::uint64_t p = 2*i + 1;
+        primes.push_back((std::uint32_t)p);
+        for(std::uint64_t j = p*p / 2; 2*j + 1 <= limit; j += p)
+            composite[j] = true;
+    }
+    return primes;
+}
+
+bigint::limbs bigint::productTree(const std::vector<std::uint32_t>& v, size_t lo, size_t hi, unsigned int threads) {   // product of v[lo, hi)
+    if(hi - lo <= 16) {
+        limbs acc = {1};
+        for(size_t i = lo; i < hi; ++i)
+            mulLimbsSmall(acc, v[i]);
+        return acc;
+    }
+    size_t mid = lo + (hi - lo) / 2;
+    if(threads > 1 && hi - lo > 256) {                  // left half on a new thread, right half on this one
+        auto left = std::async(std::launch::async, productTree, std::cref(v), lo, mid, threads / 2);
+        limbs right = productTree(v, mid, hi, threads - threads / 2);
+        return mulLimbs(left.get(), right, threads);
+    }
+    return mulLimbs(productTree(v, lo, mid), productTree(v, mid, hi));
+}
+
+bigint::limbs bigint::swingLimbs(std::uint32_t n, const std::vector<std::uint32_t>& primes, unsigned int threads) {
+    std::uint32_t root = (std::uint32_t)std::sqrt((double)n);
+    while((std::uint64_t)root * root > n)
+        root--;
+    while((std::uint64_t)(root + 1) * (root + 1) <= n)
+        root++;
+    std::vector<std::uint32_t> factors;
+    std::uint64_t word = 1;
+    for(size_t i = 0; i < primes.size() && primes[i] <= n; ++i) {
+        std::uint32_t p = primes[i];
+        std::uint64_t pe = 1;
+        if(p <= root) {
+            for(std::uint32_t q = n / p; q > 0; q /= p) {
+                if(q & 1)
+                    pe *= p;
+            }
+        } else if(p <= n / 3) {
+            if((n / p) & 1)
+                pe = p;
+        } else if(p <= n / 2) {
+            continue;
+        } else {
+            pe = p;
+        }
+        if(pe == 1)
+            continue;
+        if(word * pe > std::numeric_limits<std::uint32_t>::max()) {
+            factors.push_back((std::uint32_t)word);
+            word = 1;
+        }
+        word *= pe;
+    }
+    factors.push_back((std::uint32_t)word);
+    return productTree(factors, 0, factors.size(), threads);
+}
+
+bigint::limbs bigint::factLimbs(std::uint32_t n, const std::vector<std::uint32_t>& primes, unsigned int threads) {
+    if(n < 21) {
+        std::uint64_t f = 1;
+        for(std::uint32_t i = 2; i <= n; ++i)
+            f *= i;
+        return limbsFromU64(f);
+    }
+    if(threads > 1 && n > 4096) {                      // swing(n) and (n/2)! are independent
+        auto swing = std::async(std::launch::async, swingLimbs, n, std::cref(primes), threads / 2);
+        limbs half = factLimbs(n / 2, primes, threads - threads / 2);
+        return mulLimbs(mulLimbs(half, half, threads), swing.get(), threads);
+    }
+    limbs half = factLimbs(n / 2, primes, 1);
+    return mulLimbs(mulLimbs(half, half), swingLimbs(n, primes, 1));
+}
+
+bool bigint::isPalindrome(std::string s) {                  // checks if the Integer as string, s is Palindrome no. or not
+    if(s[0] == '-')
+        s.erase(0, 1);
+    unsigned long long int beg = 0, end = s.length() - 1;
+    while(beg < end) {
+        if(s[beg] != s[end])
+            return false;
+        beg++;
+        end--;
+    }
+    return true;
+}
+
+/*
+        ______________________________________________________
+                        Prime Check Function
+        ______________________________________________________
+                      Algorithm Explanation
+
+        Inputs below 2^64 use Miller-Rabin with the first twelve prime bases, which is
+        deterministic for every n < 3.3 * 10^24. Larger inputs run the Baillie-PSW test:
+        a strong probable prime test to base 2, then a strong Lucas probable prime test
+        with Selfridge's parameters (first D in 5, -7, 9, -11, ... with (D/n) = -1,
+        P = 1, Q = (1 - D) / 4). No composite passing both is known. Each extra round
+        adds a Miller-Rabin test to a random base.
+
+        Algorithmic Time Complexity : O(log(n) * M(n)), M = multiplication time complexity
+        Algorithmic Space Complexity : O(n)
+*/
+
+bool bigint::isPrime(std::string s, int rounds) {                // checks if the String as Number is prime or not
+    if(s[0] == '-')
+        return false;
+    limbs n = toLimbs(s);
+    std::uint64_t small;
+    if(limbsToU64(n, small))
+        return isPrimeU64(small);
+    if(trialDivideLimbs(n, SMALL_PRIME_LIMIT) != 0)     // n > 2^64, so any factor found is a proper one
+        return false;
+    return isProbablePrime(n, rounds);
+}
+
+/*
+        ______________________________________________________
+                     Trial Division Function
+        ______________________________________________________
+                      Algorithm Explanation
+
+        The primes below 2^16 are sieved once and packed into groups whose product fits a
+        32 bit word. One pass over the limbs gives n mod (group product); every prime of
+        the group is then tested against that word sized remainder. Inputs much longer than
+        the primorial of the table are first reduced modulo the primorial itself, so the
+        per-group passes run over a few thousand limbs at most. Bounds above the table
+        continue prime by prime from a sieve.
+
+        Algorithmic Time Complexity : O(n + g*min(n, P)), g = number of groups, P = primorial length
+        Algorithmic Space Complexity : O(P)
+*/
+
+unsigned long long bigint::trialDivide(std::string s, unsigned long long bound) {    // smallest prime p <= bound dividing s, 0 if none
+    return trialDivideLimbs(toLimbs(s), bound);
+}
+
+const std::vector<std::uint32_t>& bigint::smallPrimes() {
+    static const std::vector<std::uint32_t> primes = sievePrimes(SMALL_PRIME_LIMIT);
+    return primes;
+}
+
+const std::vector<bigint::primeGroup>& bigint::smallPrimeGroups() {
+    static const std::vector<primeGroup> groups = [] {
+        const std::vector<std::uint32_t>& primes = smallPrimes();
+        std::vector<primeGroup> g;
+        for(size_t i = 0; i < primes.size(); ) {
+            primeGroup grp = {1, i, i};
+            while(i < primes.size() && (std::uint64_t)grp.product * primes[i] <= std::numeric_limits<std::uint32_t>::max())
+                grp.product *= primes[i++];
+            grp.last = i;
+            g.push_back(grp);
+        }
+        return g;
+    }();
+    return groups;
+}
+
+const bigint::limbs& bigint::smallPrimorial() {
+    static const limbs primorial = [] {
+        std::vector<std::uint32_t> products;
+        for(const primeGroup& g : smallPrimeGroups())
+            products.push_back(g.product);
+        return productTree(products, 0, products.size());
+    }();
+    return primorial;
+}
+
+template<class F> std::uint64_t bigint::findLargePrime(std::uint64_t bound, F hit) {
+    // the first prime p in (2^16, min(bound, 2^32)] with hit(p), 0 if none. Primes are streamed a window at
+    // a time: below 2^32 a number with no factor under 2^16 is prime, so sieveWindow alone finds them.
+    bound = std::min<std::uint64_t>(bound, std::numeric_limits<std::uint32_t>::max());
+    const std::uint64_t WINDOW = 1 << 16;
+    std::vector<char> composite;
+    for(std::uint64_t base = SMALL_PRIME_LIMIT; base <= bound; base += WINDOW) {
+        size_t width = (size_t)std::min<std::uint64_t>(WINDOW, bound - base + 1);
+        sieveWindow(limbsFromU64(base), width, composite);
+        for(size_t i = 0; i < width; ++i) {
+            if(!composite[i] && hit(base + i))
+                return base + i;
+        }
+    }
+    return 0;
+}
+
+std::uint64_t bigint::trialDivideLimbs(const limbs& a, std::uint64_t bound) {
+    if(a.empty())
+        return 0;
+    const std::vector<std::uint32_t>& primes = smallPrimes();
+    const limbs& primorial = smallPrimorial();
+    const limbs* n = &a;
+    limbs reduced;
+    if(a.size() > 2 * primorial.size()) {               // n mod p == (n mod primorial) mod p
+        reduced = modLimbs(a, primorial);
+        n = &reduced;
+    }
+    for(const primeGroup& g : smallPrimeGroups()) {
+        if(primes[g.first] > bound)
+            return 0;
+        std::uint64_t rem = 0;
+        for(size_t i = n->size(); i-- > 0; )
+            rem = (rem * LIMB_BASE + (*n)[i]) % g.product;
+        for(size_t k = g.first; k < g.last && primes[k] <= bound; ++k) {
+            if(rem % primes[k] == 0)
+                return primes[k];
+        }
+    }
+    if(bound <= SMALL_PRIME_LIMIT)
+        return 0;
+    return findLargePrime(bound, [&a](std::uint64_t p) {
+        std::uint64_t rem = 0;
+        for(size_t i = a.size(); i-- > 0; )
+            rem = (rem * LIMB_BASE + a[i]) % p;
+        return rem == 0;
+    });
+}
+
+bool bigint::isPrimeU64(std::uint64_t n) {
+    static const std::uint64_t bases[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37};
+    if(n < 2)
+        return false;
+    for(std::uint64_t p : bases) {
+        if(n % p == 0)
+            return n == p;
+    }
+    std::uint64_t d = n - 1;
+    int s = 0;
+    while((d & 1) == 0) {
+        d >>= 1;
+        s++;
+    }
+    for(std::uint64_t a : bases) {
+        std::uint64_t x = powmodU64(a, d, n);
+        if(x == 1 || x == n - 1)
+            continue;
+        bool composite = true;
+        for(int r = 1; r < s && composite; ++r) {
+            x = (std::uint64_t)((unsigned __int128)x * x % n);
+            composite = x != n - 1;
+        }
+        if(composite)
+            return false;
+    }
+    return true;
+}
+
+int bigint::jacobiU64(std::uint64_t x, std::uint64_t y) {      // Jacobi symbol (x/y) for odd y
+    int j = 1;
+    x %= y;
+    while(x != 0) {
+        while(x % 2 == 0) {
+            x /= 2;
+            if(y % 8 == 3 || y % 8 == 5)
+                j = -j;
+        }
+        std::swap(x, y);
+        if(x % 4 == 3 && y % 4 == 3)
+            j = -j;
+        x %= y;
+    }
+    return y == 1 ? j : 0;
+}
+
+bool bigint::isProbablePrime(const limbs& n, int rounds) {     // n coprime to 10, with no small factors
+    if(!millerRabinLimbs(n, limbs{2}) || !strongLucasLimbs(n))
+        return false;
+    if(rounds <= 0)
+        return true;
+    static thread_local std::mt19937_64 rng(std::random_device{}());
+    limbs range = n;
+    subLimbs(range, limbs{3});
+    for(int i = 0; i < rounds; ++i) {                   // base uniformly-ish in [2, n-2]
+        limbs a(n.size());
+        for(std::uint32_t& limb : a)
+            limb = (std::uint32_t)(rng() % LIMB_BASE);
+        trimLimbs(a);
+        a = modLimbs(a, range);
+        addLimbsAt(a, limbs{2}, 0);
+        if(!millerRabinLimbs(n, a))
+            return false;
+    }
+    return true;
+}
+
+bool bigint::millerRabinLimbs(const limbs& n, const limbs& a) {   // strong probable prime test to base a, n coprime to 10
+    limbs n_minus_1 = n;
+    subLimbs(n_minus_1, limbs{1});
+    std::vector<unsigned char> bits = limbsToBits(n_minus_1);
+    size_t s = 0;
+    while(bits[s] == 0)
+        s++;
+    montgomery mont(n);
+    limbs minus_one(mont.k, 0);
+    mont.sub(minus_one, mont.one);
+    limbs x = powmodMont(mont, mont.to(a), bits, s);
+    if(x == mont.one || x == minus_one)
+        return true;
+    for(size_t r = 1; r < s; ++r) {
+        mont.mul(x, x, x);
+        if(x == minus_one)
+            return true;
+        if(x == mont.one)
+            return false;
+    }
+    return false;
+}
+
+bool bigint::strongLucasLimbs(const limbs& n) {               // strong Lucas probable prime test, Selfridge parameters, n coprime to 10
+    // choose D
+    long long int D = 5;
+    for(int tries = 0; ; ++tries) {
+        // (D/n) = (-1/n)^[D < 0] * (|D|/n), and by reciprocity (|D|/n) = (n mod |D| / |D|),
+        // negated when both |D| and n are 3 mod 4.
+        std::uint32_t a = (std::uint32_t)(D < 0 ? -D : D);
+        limbs t = n;
+        int j = jacobiU64(divLimbsSmall(t, a), a);
+        if(n[0] % 4 == 3 && (D < 0) != (a % 4 == 3))
+            j = -j;
+        if(j == -1)
+            break;
+        if(j == 0 && limbsFromU64(a) != n)
+            return false;                               // |D| shares a factor with n
+        if(tries == 20 && maybeSquare(n)) {             // perfect squares never find a D
+            limbs root = isqrtLimbs(n);
+            if(mulLimbs(root, root) == n)
+                return false;
+        }
+        D = D > 0 ? -(D + 2) : -D + 2;
+    }
+
+    // All values below are residues in Montgomery form.
+    montgomery mont(n);
+    auto reduce = [&](long long int v) {
+        limbs r = mont.to(limbsFromU64((std::uint64_t)(v < 0 ? -v : v)));
+        if(v < 0) {
+            limbs zero(mont.k, 0);
+            mont.sub(zero, r);
+            r.swap(zero);
+        }
+        return r;
+    };
+    auto half = [&](limbs& a) {                         // a = a / 2 mod n
+        if(a[0] & 1) {
+            limbs t = a;
+            trimLimbs(t);
+            addLimbsAt(t, n, 0);
+            divLimbsSmall(t, 2);
+            t.resize(mont.k, 0);
+            a.swap(t);
+        } else {
+            std::uint32_t rem = 0;
+            for(size_t i = a.size(); i-- > 0; ) {
+                std::uint64_t cur = (std::uint64_t)rem * LIMB_BASE + a[i];
+                a[i] = (std::uint32_t)(cur / 2);
+                rem = (std::uint32_t)(cur % 2);
+            }
+        }
+    };
+
+    const limbs Dm = reduce(D), Qm = reduce((1 - D) / 4);
+    limbs n_plus_1 = n;
+    addLimbsAt(n_plus_1, limbs{1}, 0);
+    std::vector<unsigned char> bits = limbsToBits(n_plus_1);
+    size_t s = 0;
+    while(bits[s] == 0)
+        s++;
+
+    // U_1 = 1, V_1 = P = 1, Q^1, then walk the remaining bits of d = (n+1) / 2^s
+    limbs U = mont.one, V = mont.one, Qk = Qm, t;
+    for(size_t i = bits.size() - 1; i-- > s; ) {
+        mont.mul(U, V, U);                              // U_2k = U_k V_k
+        mont.mul(V, V, V);                              // V_2k = V_k^2 - 2 Q^k
+        t = Qk;
+        mont.add(t, Qk);
+        mont.sub(V, t);
+        mont.mul(Qk, Qk, Qk);
+        if(bits[i]) {
+            limbs U2 = U, V2 = mont.mul(Dm, U);
+            mont.add(U2, V);                            // U_2k+1 = (P*U + V) / 2
+            mont.add(V2, V);                            // V_2k+1 = (D*U + P*V) / 2
+            half(U2);
+            half(V2);
+            U.swap(U2);
+            V.swap(V2);
+            mont.mul(Qk, Qm, Qk);
+        }
+    }
+    if(mont.isZero(U) || mont.isZero(V))
+        return true;
+    for(size_t r = 1; r < s; ++r) {
+        mont.mul(V, V, V);
+        t = Qk;
+        mont.add(t, Qk);
+        mont.sub(V, t);
+        if(mont.isZero(V))
+            return true;
+        mont.mul(Qk, Qk, Qk);
+    }
+    return false;
+}
+
+std::string bigint::powmod(std::string str1, std::string str2, std::string str3) {   // returns str1^str2 mod str3, in [0, str3)
+    if(str2[0] == '-')
+        throw std::runtime_error("Negative exponent in powmod.");
+    limbs m = toLimbs(str3);
+    if(m.empty())
+        throw std::runtime_error("Division by zero.");
+    limbs b = reduceSigned(str1, m);
+    return fromLimbs(powmodLimbs(b, limbsToBits(toLimbs(str2)), 0, m), false);
+}
+
+/*
+        ______________________________________________________
+                      Factorization Function
+        ______________________________________________________
+                      Algorithm Explanation
+
+        A staged pipeline, each stage bounded by a budget in factorOptions:
+        1. trial division by the primes up to trialBound (2 and 5 are always removed, the
+           later stages work in Montgomery form modulo the cofactor).
+        2. cofactors below 2^64 are finished with deterministic Miller-Rabin and Brent's
+           rho on machine words; larger ones are checked with BPSW and for being squares.
+        3. Pollard rho, Brent's variant: x -> x^2 + c, |x - y| accumulated over 128 steps
+           per gcd, finds factors p after about sqrt(p) steps.
+        4. Pollard p-1: 2^E with E = product of prime powers <= B1 finds p when p-1 is
+           B1-smooth; stage 2 also allows one extra prime up to B2 (prime gaps are walked
+           with precomputed powers 2^(E*gap)).
+        5. Lenstra's ECM on Montgomery curves (Suyama parametrization, x-only ladder):
+           stage 1 multiplies by every prime power <= B1, stage 2 pairs giant steps m*210
+           with baby steps j < 105, covering every prime m*210 +- j up to B2.
+        A factor found by any stage is split off and both parts go through the pipeline.
+
+        Algorithmic Time Complexity : depends on the smallest prime factor p; rho O(sqrt(p)),
+                                      ECM L(p)^(sqrt(2)+o(1)) products modulo n
+*/
+
+std::vector<std::string> bigint::factor(std::string s, const factorOptions& options) {     // prime factors of s, ascending
+    std::vector<std::string> ans;
+    limbs n = toLimbs(s);
+    if(n.empty())
+        throw std::runtime_error("Factorization of zero is not defined.");
+    if(s[0] == '-')
+        ans.push_back("-1");
+    std::vector<limbs> factors;
+    stripSmallFactors(n, std::max<unsigned long long>(options.trialBound, 5), factors);
+    if(n != limbs{1})
+        factorLimbs(n, options, factors);
+    std::sort(factors.begin(), factors.end(), [](const limbs& a, const limbs& b) {
+        return compareLimbs(a, b) < 0;
+    });
+    for(const limbs& f : factors)
+        ans.push_back(fromLimbs(f, false));
+    return ans;
+}
+
+void bigint::stripSmallFactors(limbs& n, std::uint64_t bound, std::vector<limbs>& out) {   // removes all prime factors <= bound
+    auto strip = [&](std::uint32_t p) {
+        limbs t = n;
+        while(n != limbs{1} && divLimbsSmall(t, p) == 0) {
+            n = t;
+            out.push_back(limbsFromU64(p));
+        }
+    };
+    const std::vector<std::uint32_t>& primes = smallPrimes();
+    for(const primeGroup& g : smallPrimeGroups()) {
+        if(primes[g.first] > bound)
+            return;
+        std::uint64_t rem = 0;
+        for(size_t i = n.size(); i-- > 0; )
+            rem = (rem * LIMB_BASE + n[i]) % g.product;
+        for(size_t k = g.first; k < g.last && primes[k] <= bound; ++k) {
+            if(rem % primes[k] == 0)
+                strip(primes[k]);
+        }
+    }
+    if(bound <= SMALL_PRIME_LIMIT)
+        return;
+    findLargePrime(bound, [&](std::uint64_t p) {
+        strip((std::uint32_t)p);
+        return n == limbs{1};                           // fully stripped: stop streaming
+    });
+}
+
+void bigint::factorLimbs(const limbs& n, const factorOptions& options, std::vector<limbs>& out) {
+    std::uint64_t small;
+    if(limbsToU64(n, small)) {
+        factorU64(small, out);
+        return;
+    }
+    if(isProbablePrime(n, 0)) {
+        out.push_back(n);
+        return;
+    }
+    if(maybeSquare(n)) {
+        limbs root = isqrtLimbs(n);
+        if(mulLimbs(root, root) == n) {
+            factorLimbs(root, options, out);
+            factorLimbs(root, options, out);
+            return;
+        }
+    }
+    limbs d;
+    if(options.rhoIterations)
+        d = pollardRho(n, options.rhoIterations);
+    if(d.empty() && options.pm1B1)
+        d = pollardPm1(n, options.pm1B1, options.pm1B2);
+    if(d.empty() && options.ecmCurves && options.ecmB1)
+        d = ecm(n, options.ecmCurves, options.ecmB1, options.ecmB2);
+    if(d.empty()) {
+        out.push_back(n);                               // budgets exhausted, composite cofactor
+        return;
+    }
+    factorLimbs(d, options, out);
+    factorLimbs(divexactLimbs(n, d), options, out);
+}
+
+void bigint::factorU64(std::uint64_t n, std::vector<limbs>& out) {
+    if(n == 1)
+        return;
+    if(isPrimeU64(n)) {
+        out.push_back(limbsFromU64(n));
+        return;
+    }
+    std::uint64_t d = pollardRhoU64(n);
+    factorU64(d, out);
+    factorU64(n / d, out);
+}
+
+std::uint64_t bigint::pollardRhoU64(std::uint64_t n) {        // a proper factor of the odd composite n
+    for(std::uint64_t c = 1; ; ++c) {
+        auto f = [&](std::uint64_t x) {
+            return (std::uint64_t)(((unsigned __int128)x * x + c) % n);
+        };
+        std::uint64_t x = 2, y = 2, ys = 2, q = 1, g = 1;
+        for(std::uint64_t r = 1; g == 1; r *= 2) {
+            x = y;
+            for(std::uint64_t i = 0; i < r; ++i)
+                y = f(y);
+            for(std::uint64_t k = 0; k < r && g == 1; k += 128) {
+                ys = y;
+                for(std::uint64_t i = 0; i < 128 && i < r - k; ++i) {
+                    y = f(y);
+                    q = (std::uint64_t)((unsigned __int128)q * (x > y ? x - y : y - x) % n);
+                }
+                g = std::gcd(q, n);
+            }
+        }
+        if(g == n) {                                    // the batch overshot: replay it one step at a time
+            do {
+                ys = f(ys);
+                g = std::gcd(x > ys ? x - ys : ys - x, n);
+            } while(g == 1);
+        }
+        if(g != n)
+            return g;
+    }
+}
+
+bigint::limbs bigint::pollardRho(const limbs& n, std::uint64_t iterations) {    // Brent's rho in Montgomery form, {} if the budget runs out
+    montgomery mont(n);
+    static thread_local std::mt19937_64 rng(std::random_device{}());
+    const limbs one = {1};
+    std::uint64_t used = 0;
+    while(used < iterations) {
+        limbs c = mont.to(limbsFromU64(rng() % LIMB_BASE + 1));
+        limbs y = mont.to(limbsFromU64(rng() % LIMB_BASE));
+        limbs x, ys, q = mont.one, diff, g = one;
+        auto f = [&](limbs& v) {
+            mont.mul(v, v, v);
+            mont.add(v, c);
+        };
+        for(std::uint64_t r = 1; g == one && used < iterations; r *= 2) {
+            x = y;
+            for(std::uint64_t i = 0; i < r; ++i)
+                f(y);
+            for(std::uint64_t k = 0; k < r && g == one; k += 128) {
+                ys = y;
+                for(std::uint64_t i = 0; i < 128 && i < r - k; ++i) {
+                    f(y);
+                    diff = x;
+                    mont.sub(diff, y);
+                    mont.mul(q, diff, q);
+                }
+                diff = q;
+                trimLimbs(diff);
+                g = gcdLimbs(diff, n);
+            }
+            used += 2 * r;
+        }
+        if(g == n) {
+            do {
+                f(ys);
+                diff = x;
+                mont.sub(diff, ys);
+                trimLimbs(diff);
+                g = gcdLimbs(diff, n);
+            } while(g == one);
+        }
+        if(g != one && g != n)
+            return g;
+    }
+    return limbs();
+}
+
+bigint::limbs bigint::pollardPm1(const limbs& n, std::uint64_t B1, std::uint64_t B2) {    // Pollard p-1, {} if no factor
+    montgomery mont(n);
+    const limbs one = {1};
+    B2 = std::min<std::uint64_t>(std::max(B1, B2), std::numeric_limits<std::uint32_t>::max());
+    std::vector<std::uint32_t> primes = sievePrimes((std::uint32_t)B2);
+    auto split = [&](const limbs& a, limbs& g) {        // g = gcd(a - 1, n), true if it is a proper factor
+        limbs t = a;
+        mont.sub(t, mont.one);
+        trimLimbs(t);
+        g = gcdLimbs(t, n);
+        return g != one && g != n;
+    };
+
+    // stage 1: a = 2^E, E = product of the prime powers <= B1
+    limbs a = mont.to(limbs{2}), g;
+    std::uint64_t e = 1;
+    size_t idx = 0;
+    for(; idx < primes.size() && primes[idx] <= B1; ++idx) {
+        std::uint64_t pk = primes[idx];
+        while(pk <= B1 / primes[idx])
+            pk *= primes[idx];
+        if(e > std::numeric_limits<std::uint64_t>::max() / pk) {
+            a = powmodMontU64(mont, a, e);
+            e = 1;
+        }
+        e *= pk;
+    }
+    a = powmodMontU64(mont, a, e);
+    if(split(a, g))
+        return g;
+    if(g == n || idx == primes.size())
+        return limbs();
+
+    // stage 2: one more prime q in (B1, B2], x = a^q walked along the prime gaps
+    std::vector<limbs> step(1, mont.one);               // step[i] = a^(2i)
+    limbs a2 = mont.mul(a, a);
+    limbs x = powmodMontU64(mont, a, primes[idx]), acc = mont.one, t;
+    for(size_t i = idx; i < primes.size(); ++i) {
+        if(i > idx) {
+            size_t gap = (primes[i] - primes[i-1]) / 2;
+            while(step.size() <= gap)
+                step.push_back(mont.mul(step.back(), a2));
+            mont.mul(x, step[gap], x);
+        }
+        t = x;
+        mont.sub(t, mont.one);
+        mont.mul(acc, t, acc);
+        if((i - idx) % 1024 == 1023 || i + 1 == primes.size()) {
+            t = acc;
+            trimLimbs(t);
+            g = gcdLimbs(t, n);
+            if(g != one)
+                return g != n ? g : limbs();
+        }
+    }
+    return limbs();
+}
+
+bigint::limbs bigint::ecm(const limbs& n, unsigned int curves, std::uint64_t B1, std::uint64_t B2) {    // Lenstra's ECM, {} if no factor
+    montgomery mont(n);
+    const limbs one = {1};
+    const std::uint32_t D = 210;
+    B2 = std::min<std::uint64_t>(std::max(B1, B2), std::numeric_limits<std::uint32_t>::max() - D);
+    std::vector<std::uint32_t> primes = sievePrimes((std::uint32_t)B2);
+    std::vector<bool> is_prime(B2 + D + 1, false);
+    for(std::uint32_t p : primes)
+        is_prime[p] = true;
+    std::vector<std::uint32_t> baby;                    // j < D/2 coprime to D
+    for(std::uint32_t j = 1; j < D / 2; j += 2) {
+        if(std::gcd(j, D) == 1)
+            baby.push_back(j);
+    }
+    static thread_local std::mt19937_64 rng(std::random_device{}());
+
+    limbs a24, t1, t2, t3;
+    auto xdbl = [&](const limbs& X, const limbs& Z, limbs& X2, limbs& Z2) {
+        t1 = X;
+        mont.add(t1, Z);
+        mont.mul(t1, t1, t1);                           // (X+Z)^2
+        t2 = X;
+        mont.sub(t2, Z);
+        mont.mul(t2, t2, t2);                           // (X-Z)^2
+        t3 = t1;
+        mont.sub(t3, t2);                               // 4XZ
+        mont.mul(t1, t2, X2);
+        limbs w = mont.mul(a24, t3);
+        mont.add(w, t2);
+        mont.mul(t3, w, Z2);
+    };
+    auto xadd = [&](const limbs& XP, const limbs& ZP, const limbs& XQ, const limbs& ZQ,
+                    const limbs& Xd, const limbs& Zd, limbs& X, limbs& Z) {
+        limbs u = XP, v = XP, s1 = XQ, s2 = XQ;
+        mont.sub(u, ZP);
+        mont.add(s1, ZQ);
+        mont.mul(u, s1, u);                             // (XP-ZP)(XQ+ZQ)
+        mont.add(v, ZP);
+        mont.sub(s2, ZQ);
+        mont.mul(v, s2, v);                             // (XP+ZP)(XQ-ZQ)
+        limbs sum = u, dif = u;
+        mont.add(sum, v);
+        mont.sub(dif, v);
+        mont.mul(sum, sum, sum);
+        mont.mul(dif, dif, dif);
+        mont.mul(Zd, sum, X);
+        mont.mul(Xd, dif, Z);
+    };
+    auto ladder = [&](const limbs& X, const limbs& Z, std::uint64_t k, limbs& RX, limbs& RZ) {
+        limbs X0 = X, Z0 = Z, X1, Z1;
+        xdbl(X, Z, X1, Z1);
+        int top = 63;
+        while(!((k >> top) & 1))
+            top--;
+        for(int b = top - 1; b >= 0; --b) {
+            if((k >> b) & 1) {
+                xadd(X0, Z0, X1, Z1, X, Z, X0, Z0);
+                xdbl(X1, Z1, X1, Z1);
+            } else {
+                xadd(X0, Z0, X1, Z1, X, Z, X1, Z1);
+                xdbl(X0, Z0, X0, Z0);
+            }
+        }
+        RX.swap(X0);
+        RZ.swap(Z0);
+    };
+
+    for(unsigned int curve = 0; curve < curves; ++curve) {
+        // Suyama: u = sigma^2 - 5, v = 4 sigma, (x : z) = (u^3 : v^3), a24 = (v-u)^3 (3u+v) / (16 u^3 v)
+        std::uint64_t sigma = 6 + rng() % (1ull << 31);
+        limbs u = mont.to(limbsFromU64(sigma * sigma - 5)), v = mont.to(limbsFromU64(4 * sigma));
+        limbs X = mont.mul(mont.mul(u, u), u), Z = mont.mul(mont.mul(v, v), v);
+        limbs num = v, den, w = u, inv, g;
+        mont.sub(num, u);
+        num = mont.mul(mont.mul(num, num), num);
+        mont.add(w, u);
+        mont.add(w, u);
+        mont.add(w, v);
+        mont.mul(num, w, num);
+        den = mont.mul(mont.mul(X, v), mont.to(limbs{16}));
+        g = invmodLimbs(mont.from(den), n, inv);
+        if(g != one) {
+            if(g != n)
+                return g;
+            continue;
+        }
+        a24 = mont.mul(num, mont.to(inv));
+
+        // stage 1
+        for(size_t i = 0; i < primes.size() && primes[i] <= B1; ++i) {
+            std::uint64_t pk = primes[i];
+            while(pk <= B1 / primes[i])
+                pk *= primes[i];
+            ladder(X, Z, pk, X, Z);
+        }
+        limbs t = Z;
+        trimLimbs(t);
+        g = gcdLimbs(t, n);
+        if(g != one) {
+            if(g != n)
+                return g;
+            continue;
+        }
+        if(B2 <= B1)
+            continue;
+
+        // stage 2: x([m D]Q) == x([j]Q) mod p  <=>  [m D +- j]Q == O mod p
+        std::vector<limbs> BX(D / 2), BZ(D / 2);
+        limbs X2, Z2;
+        xdbl(X, Z, X2, Z2);
+        BX[1] = X;
+        BZ[1] = Z;
+        xadd(X2, Z2, X, Z, X, Z, BX[3], BZ[3]);
+        for(std::uint32_t j = 5; j < D / 2; j += 2)
+            xadd(BX[j-2], BZ[j-2], X2, Z2, BX[j-4], BZ[j-4], BX[j], BZ[j]);
+        limbs GX, GZ, TX, TZ, PX, PZ, NX, NZ;
+        ladder(X, Z, D, GX, GZ);
+        std::uint64_t m = std::max<std::uint64_t>(B1 / D, 1);
+        ladder(X, Z, m * D, TX, TZ);
+        if(m > 1)
+            ladder(X, Z, (m - 1) * D, PX, PZ);
+        limbs acc = mont.one, prod;
+        for(; m * D <= B2 + D / 2; ++m) {
+            for(std::uint32_t j : baby) {
+                std::uint64_t hi = m * D + j, lo = m * D - j;
+                if((hi > B1 && hi <= B2 && is_prime[hi]) || (lo > B1 && lo <= B2 && is_prime[lo])) {
+                    prod = mont.mul(TX, BZ[j]);
+                    mont.sub(prod, mont.mul(BX[j], TZ));
+                    mont.mul(acc, prod, acc);
+                }
+            }
+            if(m == 1)
+                xdbl(TX, TZ, NX, NZ);
+            else
+                xadd(TX, TZ, GX, GZ, PX, PZ, NX, NZ);
+            PX.swap(TX);
+            PZ.swap(TZ);
+            TX.swap(NX);
+            TZ.swap(NZ);
+        }
+        t = acc;
+        trimLimbs(t);
+        g = gcdLimbs(t, n);
+        if(g != one && g != n)
+            return g;
+    }
+    return limbs();
+}
+
+/*
+        ______________________________________________________
+                      Prime Search Functions
+        ______________________________________________________
+                      Algorithm Explanation
+
+        Candidates are taken a window at a time, [base, base + w) with w about 17*ln(base),
+        so a window usually holds the next prime. For every prime p below 2^16, base mod p
+        comes from one pass over the limbs per word sized group of primes (as in trial
+        division), and the multiples of p in the window are crossed off. Only the survivors,
+        about 5% of the window, are handed to BPSW; below 2^64 the deterministic
+        Miller-Rabin decides instead. big_primeRange walks [lo, hi) window by window.
+
+        Algorithmic Time Complexity : O(g*n + w*loglog(2^16)) per window, plus one BPSW per survivor
+        Algorithmic Space Complexity : O(w)
+*/
+
+std::string bigint::nextPrime(std::string s) {                  // smallest prime > s
+    if(s[0] == '-')
+        return "2";
+    return fromLimbs(nextPrimeLimbs(toLimbs(s)), false);
+}
+
+std::string bigint::prevPrime(std::string s) {                  // largest prime < s
+    limbs p = s[0] == '-' ? limbs() : prevPrimeLimbs(toLimbs(s));
+    if(p.empty())
+        throw std::runtime_error("There is no prime below the given number.");
+    return fromLimbs(p, false);
+}
+
+size_t bigint::primeWindow(const limbs& base) {                 // about 17*ln(base), at least 1024
+    return std::max<size_t>(1024, 40 * LIMB_DIGITS * base.size());
+}
+
+void bigint::sieveWindow(const limbs& base, size_t width, std::vector<char>& composite) {   // marks base + i with a factor < 2^16
+    composite.assign(width, 0);
+    std::uint64_t small = 0;
+    bool fits = limbsToU64(base, small);
+    for(std::uint64_t v = small; fits && v < 2 && v - small < width; ++v)
+        composite[v - small] = 1;                       // 0 and 1
+    const std::vector<std::uint32_t>& primes = smallPrimes();
+    const limbs& primorial = smallPrimorial();
+    const limbs* n = &base;
+    limbs reduced;
+    if(base.size() > 2 * primorial.size()) {
+        reduced = modLimbs(base, primorial);
+        n = &reduced;
+    }
+    for(const primeGroup& g : smallPrimeGroups()) {
+        std::uint64_t rem = 0;
+        for(size_t i = n->size(); i-- > 0; )
+            rem = (rem * LIMB_BASE + (*n)[i]) % g.product;
+        for(size_t k = g.first; k < g.last; ++k) {
+            std::uint64_t p = primes[k];
+            for(std::uint64_t i = (p - rem % p) % p; i < width; i += p)
+                composite[i] = 1;
+            if(fits && small <= p && p - small < width)   // p itself is in the window
+                composite[p - small] = 0;
+        }
+    }
+}
+
+bool bigint::isSievedPrime(const limbs& n) {                    // n has no prime factor below 2^16 (or is one)
+    std::uint64_t small;
+    if(limbsToU64(n, small))
+        return isPrimeU64(small);
+    return isProbablePrime(n, 0);
+}
+
+bigint::limbs bigint::nextPrimeLimbs(const limbs& a) {
+    limbs base = a, candidate;
+    addLimbsAt(base, limbs{1}, 0);
+    std::vector<char> composite;
+    while(true) {
+        size_t width = primeWindow(base);
+        sieveWindow(base, width, composite);
+        for(size_t i = 0; i < width; ++i) {
+            if(composite[i])
+                continue;
+            candidate = base;
+            addLimbsAt(candidate, limbsFromU64(i), 0);
+            if(isSievedPrime(candidate))
+                return candidate;
+        }
+        addLimbsAt(base, limbsFromU64(width), 0);
+    }
+}
+
+bigint::limbs bigint::prevPrimeLimbs(const limbs& a) {         // {} if a <= 2
+    limbs hi = a, lo, candidate;
+    std::vector<char> composite;
+    while(compareLimbs(hi, limbs{2}) > 0) {             // search [lo, hi)
+        limbs width = limbsFromU64(primeWindow(hi));
+        lo = hi;
+        if(compareLimbs(lo, width) > 0)
+            subLimbs(lo, width);
+        else
+            lo.clear();
+        limbs span = hi;
+        subLimbs(span, lo);
+        std::uint64_t w = 0;                            // span <= width, so it always fits
+        limbsToU64(span, w);
+        sieveWindow(lo, (size_t)w, composite);
+        for(size_t i = (size_t)w; i-- > 0; ) {
+            if(composite[i])
+                continue;
+            candidate = lo;
+            addLimbsAt(candidate, limbsFromU64(i), 0);
+            if(isSievedPrime(candidate))
+                return candidate;
+        }
+        hi = lo;
+    }
+    return limbs();
+}
+
+bigint::primeRange bigint::_big_primeRange(bigint const &lo, bigint const &hi) {
+    return primeRange(lo, hi);
+}
+
+bigint::primeRange::primeRange(bigint const &lo, bigint const &hi)
+    : lo(lo.str[0] == '-' ? limbs() : toLimbs(lo.str)), hi(hi.str[0] == '-' ? limbs() : toLimbs(hi.str)) {}
+
+bigint::primeRange::iterator::iterator(const limbs& lo, const limbs& hi) : base(lo), hi(hi), done(false) {
+    advance();
+}
+
+void bigint::primeRange::iterator::advance() {
+    while(!done) {
+        if(pos == composite.size()) {                   // load the next window
+            addLimbsAt(base, limbsFromU64(composite.size()), 0);
+            if(compareLimbs(base, hi) >= 0) {
+                done = true;
+                return;
+            }
+            limbs span = hi;
+            subLimbs(span, base);
+            std::uint64_t left;
+            size_t width = primeWindow(base);
+            if(limbsToU64(span, left) && left < width)
+                width = (size_t)left;
+            sieveWindow(base, width, composite);
+            pos = 0;
+        }
+        size_t i = pos++;
+        if(composite[i])
+            continue;
+        limbs candidate = base;
+        addLimbsAt(candidate, limbsFromU64(i), 0);
+        if(isSievedPrime(candidate)) {
+            current.str = fromLimbs(candidate, false);
+            return;
+        }
+    }
+}
+
+/*
+        ______________________________________________________
+                  Chinese Remainder and RNS Functions
+        ______________________________________________________
+                      Algorithm Explanation
+
+        crtBasis keeps the subproduct tree of the moduli m[i] (products of halves, M at the
+        root) and y[i] = (M/m[i])^-1 mod m[i]. Reconstruction is
+          x = sum (r[i] * y[i] mod m[i]) * M/m[i]   (mod M)
+        evaluated bottom up: a node returns left * (product of right) + right * (product of
+        left), so every multiplication is between operands of matching size. reduce() runs
+        the same tree top down, taking x modulo each node's product.
+        rnsInt stores one residue per word sized prime. Lane products use a Barrett reduction
+        with a precomputed floor(2^64 / p), so add, sub and mul are independent loops over
+        the lanes that the compiler can unroll and vectorize.
+
+        Algorithmic Time Complexity : O(M(n) log k) per combine / reduce, k moduli of n limbs total;
+                                      O(k) per rnsInt operation
+*/
+
+bigint bigint::_big_crt(std::vector<bigint> const &residues, std::vector<bigint> const &moduli) {
+    return crtBasis(moduli).combine(residues);
+}
+
+bigint::crtBasis::crtBasis(std::vector<bigint> const &moduli) {
+    if(moduli.empty())
+        throw std::runtime_error("CRT basis needs at least one modulus.");
+    for(const bigint& mod : moduli) {
+        if(mod.str[0] == '-' || mod.str == "0")
+            throw std::runtime_error("CRT moduli must be positive.");
+        m.push_back(toLimbs(mod.str));
+    }
+    tree.resize(4 * m.size());
+    build(1, 0, m.size());
+    for(size_t i = 0; i < m.size(); ++i) {
+        limbs inv, g = invmodLimbs(modLimbs(divexactLimbs(tree[1], m[i]), m[i]), m[i], inv);
+        if(g != limbs{1})
+            throw std::runtime_error("CRT moduli must be pairwise coprime.");
+        y.push_back(inv);
+    }
+}
+
+void bigint::crtBasis::build(size_t node, size_t lo, size_t hi) {
+    if(hi - lo == 1) {
+        tree[node] = m[lo];
+        return;
+    }
+    size_t mid = lo + (hi - lo) / 2;
+    build(2*node, lo, mid);
+    build(2*node + 1, mid, hi);
+    tree[node] = mulLimbs(tree[2*node], tree[2*node + 1]);
+}
+
+bigint::limbs bigint::crtBasis::combineTree(const std::vector<limbs>& v, size_t node, size_t lo, size_t hi) const {
+    if(hi - lo == 1)
+        return v[lo];
+    size_t mid = lo + (hi - lo) / 2;
+    limbs left = mulLimbs(combineTree(v, 2*node, lo, mid), tree[2*node + 1]);
+    addLimbsAt(left, mulLimbs(combineTree(v, 2*node + 1, mid, hi), tree[2*node]), 0);
+    return left;
+}
+
+bigint::limbs bigint::crtBasis::combineLimbs(std::vector<limbs> r) const {   // r[i] already in [0, m[i])
+    for(size_t i = 0; i < r.size(); ++i)
+        r[i] = modLimbs(mulLimbs(r[i], y[i]), m[i]);
+    return modLimbs(combineTree(r, 1, 0, r.size()), tree[1]);
+}
+
+void bigint::crtBasis::reduceTree(const limbs& x, size_t node, size_t lo, size_t hi, std::vector<limbs>& out) const {
+    limbs r = compareLimbs(x, tree[node]) < 0 ? x : modLimbs(x, tree[node]);
+    if(hi - lo == 1) {
+        out[lo].swap(r);
+        return;
+    }
+    size_t mid = lo + (hi - lo) / 2;
+    reduceTree(r, 2*node, lo, mid, out);
+    reduceTree(r, 2*node + 1, mid, hi, out);
+}
+
+bigint bigint::crtBasis::combine(std::vector<bigint> const &residues) const {
+    if(residues.size() != m.size())
+        throw std::runtime_error("Number of residues does not match the CRT basis.");
+    std::vector<limbs> r(m.size());
+    for(size_t i = 0; i < m.size(); ++i) {
+        r[i] = modLimbs(toLimbs(residues[i].str), m[i]);
+        if(residues[i].str[0] == '-' && !r[i].empty()) {
+            limbs t = m[i];
+            subLimbs(t, r[i]);
+            r[i].swap(t);
+        }
+    }
+    bigint ans;
+    ans.str = fromLimbs(combineLimbs(r), false);
+    return ans;
+}
+
+bigint bigint::crtBasis::combine(std::vector<std::uint32_t> const &residues) const {
+    if(residues.size() != m.size())
+        throw std::runtime_error("Number of residues does not match the CRT basis.");
+    std::vector<limbs> r(m.size());
+    for(size_t i = 0; i < m.size(); ++i)
+        r[i] = modLimbs(limbsFromU64(residues[i]), m[i]);
+    bigint ans;
+    ans.str = fromLimbs(combineLimbs(r), false);
+    return ans;
+}
+
+std::vector<bigint> bigint::crtBasis::reduce(bigint const &x) const {
+    std::vector<limbs> r(m.size());
+    reduceTree(toLimbs(x.str), 1, 0, m.size(), r);
+    std::vector<bigint> ans(m.size());
+    for(size_t i = 0; i < m.size(); ++i) {
+        if(x.str[0] == '-' && !r[i].empty()) {
+            limbs t = m[i];
+            subLimbs(t, r[i]);
+            r[i].swap(t);
+        }
+        ans[i].str = fromLimbs(r[i], false);
+    }
+    return ans;
+}
+
+bigint bigint::crtBasis::modulus() const {
+    bigint ans;
+    ans.str = fromLimbs(tree[1], false);
+    return ans;
+}
+
+std::vector<std::uint32_t> bigint::rnsBasis::pickPrimes(size_t bits) {     // largest primes below 2^32 until their product exceeds 2^(bits+1)
+    std::vector<std::uint32_t> p;
+    double total = 0;
+    for(std::uint32_t q = std::numeric_limits<std::uint32_t>::max(); total <= bits + 2; q -= 2) {
+        if(isPrimeU64(q)) {
+            p.push_back(q);
+            total += std::log2((double)q);
+        }
+    }
+    return p;
+}
+
+std::vector<bigint> bigint::rnsBasis::asBigints(const std::vector<std::uint32_t>& primes) {
+    std::vector<bigint> v;
+    for(std::uint32_t q : primes)
+        v.push_back(bigint((long long)q));
+    return v;
+}
+
+bigint::rnsBasis::rnsBasis(size_t bits) : primes(pickPrimes(bits)), basis(asBigints(primes)) {
+    for(std::uint32_t q : primes)
+        barrett.push_back(std::numeric_limits<std::uint64_t>::max() / q);
+}
+
+bigint::rnsInt::rnsInt(std::shared_ptr<const rnsBasis> b, bigint const &value) : basis(std::move(b)), lanes(basis->size()) {
+    std::vector<limbs> r(basis->size());
+    basis->basis.reduceTree(toLimbs(value.str), 1, 0, r.size(), r);
+    for(size_t i = 0; i < r.size(); ++i) {
+        std::uint64_t v = 0;                            // a residue below a 32 bit prime, so it always fits
+        limbsToU64(r[i], v);
+        lanes[i] = (std::uint32_t)v;
+    }
+    if(value.str[0] == '-')
+        *this = -*this;
+}
+
+bigint bigint::rnsInt::toBigint() const {
+    std::vector<limbs> r(lanes.size());
+    for(size_t i = 0; i < lanes.size(); ++i)
+        r[i] = limbsFromU64(lanes[i]);
+    limbs x = basis->basis.combineLimbs(r), twice = x;
+    addLimbsAt(twice, x, 0);
+    bigint ans;
+    if(compareLimbs(twice, basis->basis.tree[1]) > 0) {     // above M/2: a negative value
+        limbs t = basis->basis.tree[1];
+        subLimbs(t, x);
+        ans.str = fromLimbs(t, true);
+    } else {
+        ans.str = fromLimbs(x, false);
+    }
+    return ans;
+}
+
+void bigint::rnsInt::checkBasis(const rnsInt& b) const {
+    if(basis != b.basis)
+        throw std::runtime_error("RNS operands use different bases.");
+}
+
+bigint::rnsInt& bigint::rnsInt::operator+=(const rnsInt& b) {
+    checkBasis(b);
+    const std::vector<std::uint32_t>& p = basis->primes;
+    for(size_t i = 0; i < lanes.size(); ++i) {
+        std::uint64_t s = (std::uint64_t)lanes[i] + b.lanes[i];
+        lanes[i] = (std::uint32_t)(s >= p[i] ? s - p[i] : s);
+    }
+    return *this;
+}
+
+bigint::rnsInt& bigint::rnsInt::operator-=(const rnsInt& b) {
+    checkBasis(b);
+    const std::vector<std::uint32_t>& p = basis->primes;
+    for(size_t i = 0; i < lanes.size(); ++i) {
+        std::uint64_t s = (std::uint64_t)lanes[i] + p[i] - b.lanes[i];
+        lanes[i] = (std::uint32_t)(s >= p[i] ? s - p[i] : s);
+    }
+    return *this;
+}
+
+bigint::rnsInt& bigint::rnsInt::operator*=(const rnsInt& b) {
+    checkBasis(b);
+    const std::vector<std::uint32_t>& p = basis->primes;
+    const std::vector<std::uint64_t>& inv = basis->barrett;
+    for(size_t i = 0; i < lanes.size(); ++i) {
+        std::uint64_t x = (std::uint64_t)lanes[i] * b.lanes[i];
+        std::uint64_t q = (std::uint64_t)(((unsigned __int128)x * inv[i]) >> 64);
+        std::uint64_t r = x - q * p[i];                 // q is at most 2 short of x / p
+        while(r >= p[i])
+            r -= p[i];
+        lanes[i] = (std::uint32_t)r;
+    }
+    return *this;
+}
+
+bigint::rnsInt bigint::rnsInt::operator-() const {
+    rnsInt r = *this;
+    const std::vector<std::uint32_t>& p = basis->primes;
+    for(size_t i = 0; i < lanes.size(); ++i)
+        r.lanes[i] = lanes[i] ? p[i] - lanes[i] : 0;
+    return r;
+}
+
+/*
+        ______________________________________________________
+                  Jacobi Symbol and Modular Square Root
+        ______________________________________________________
+                      Algorithm Explanation
+
+        Jacobi symbol, binary algorithm: strip factors of 2 from a, each one flipping the
+        sign when n = 3, 5 mod 8; when a < n swap them (quadratic reciprocity flips the
+        sign when both are 3 mod 4); then replace a by a - n, which is even again. Only
+        halvings, subtractions and the low bits of a[0] are needed (10^9 is a multiple of
+        2^9), no division. Kronecker extends it to even and negative n.
+
+        Square root of a residue a modulo an odd prime p, in Montgomery form:
+          - p = 3 mod 4 : r = a^((p+1)/4)
+          - p = 5 mod 8 : Atkin, b = (2a)^((p-5)/8), i = 2ab^2, r = ab(i - 1)
+          - p = 1 mod 8 : with p - 1 = q*2^s, Tonelli-Shanks costs one exponentiation plus
+                          O(s^2) products; when s is large compared with log p, Cipolla's
+                          (t + sqrt(t^2 - a))^((p+1)/2) in F_p[sqrt(t^2 - a)] is used instead.
+        maybeSquare rejects most non-squares by their residues mod 64, 63, 65 and 11 before
+        an integer square root is attempted.
+
+        Algorithmic Time Complexity : O(n^2) for the symbol, O(M(n) log p) for the root
+*/
+
+bigint::limbs bigint::reduceSigned(const std::string& s, const limbs& m) {    // s mod m in [0, m)
+    limbs r = modLimbs(toLimbs(s), m);
+    if(s[0] == '-' && !r.empty()) {
+        limbs t = m;
+        subLimbs(t, r);
+        r.swap(t);
+    }
+    return r;
+}
+
+int bigint::jacobiLimbs(limbs a, limbs n) {                    // (a/n) for odd n > 0
+    a = modLimbs(a, n);
+    int t = 1;
+    while(!a.empty()) {
+        while(a[0] % 2 == 0) {
+            int v = 0;                                  // the low 9 bits of a are those of a[0]
+            while(v < 9 && !((a[0] >> v) & 1))
+                v++;
+            divLimbsSmall(a, 1u << v);
+            if(v % 2 == 1 && (n[0] % 8 == 3 || n[0] % 8 == 5))
+                t = -t;
+        }
+        if(compareLimbs(a, n) < 0) {
+            a.swap(n);
+            if(a[0] % 4 == 3 && n[0] % 4 == 3)
+                t = -t;
+        }
+        subLimbs(a, n);
+    }
+    return n == limbs{1} ? t : 0;
+}
+
+int bigint::jacobi(std::string a, std::string n) {              // Jacobi symbol (a/n)
+    limbs m = toLimbs(n);
+    if(n[0] == '-' || m.empty() || m[0] % 2 == 0)
+        throw std::runtime_error("Jacobi symbol needs an odd positive modulus.");
+    return jacobiLimbs(reduceSigned(a, m), m);
+}
+
+int bigint::kronecker(std::string a, std::string n) {           // Kronecker symbol (a/n)
+    limbs x = toLimbs(a), m = toLimbs(n);
+    bool a_neg = a[0] == '-';
+    if(m.empty())
+        return x == limbs{1} ? 1 : 0;
+    int t = n[0] == '-' && a_neg ? -1 : 1;              // (a/-1)
+    size_t v = removeTwos(m);
+    if(v > 0) {
+        if(x.empty() || x[0] % 2 == 0)
+            return 0;
+        std::uint32_t r = x[0] % 8;                     // (a/2) = 1 for a = +-1 mod 8, -1 for a = +-3 mod 8
+        if(a_neg)
+            r = (8 - r) % 8;
+        if(v % 2 == 1 && (r == 3 || r == 5))
+            t = -t;
+    }
+    limbs r = modLimbs(x, m);
+    if(a_neg && !r.empty()) {
+        limbs u = m;
+        subLimbs(u, r);
+        r.swap(u);
+    }
+    return t * jacobiLimbs(r, m);
+}
+
+bool bigint::maybeSquare(const limbs& n) {                     // false only if n is certainly not a square
+    static const std::uint32_t moduli[4] = {64, 63, 65, 11};
+    static const std::vector<bool>* tables = [] {
+        static std::vector<bool> t[4];
+        for(int k = 0; k < 4; ++k) {
+            t[k].assign(moduli[k], false);
+            for(std::uint32_t r = 0; r < moduli[k]; ++r)
+                t[k][r * r % moduli[k]] = true;
+        }
+        return t;
+    }();
+    if(n.empty())
+        return true;
+    if(!tables[0][n[0] % 64])                           // 10^9 is a multiple of 64
+        return false;
+    std::uint64_t rem = 0;                              // n mod 63*65*11
+    for(size_t i = n.size(); i-- > 0; )
+        rem = (rem * LIMB_BASE + n[i]) % 45045;
+    return tables[1][rem % 63] && tables[2][rem % 65] && tables[3][rem % 11];
+}
+
+std::string bigint::sqrtmod(std::string a, std::string p) {     // r in [0, p/2] with r^2 = a mod p
+    limbs m = toLimbs(p);
+    if(p[0] == '-' || !isPrime(p))
+        throw std::runtime_error("Modulus of sqrtmod must be a prime.");
+    limbs x = reduceSigned(a, m);
+    if(m == limbs{2} || x.empty())
+        return fromLimbs(x, false);
+    if(jacobiLimbs(x, m) != 1)
+        throw std::runtime_error("No square root: a is a quadratic non-residue.");
+    if(m == limbs{5})                                   // the only prime Montgomery form cannot take
+        return x == limbs{1} ? "1" : "2";
+    return fromLimbs(sqrtmodLimbs(x, m), false);
+}
+
+bigint::limbs bigint::sqrtmodLimbs(const limbs& a, const limbs& p) {   // a a non-zero residue, p an odd prime coprime to 10
+    montgomery mont(p);
+    limbs A = mont.to(a), r;
+    auto power = [&](const limbs& base, const limbs& e) {
+        return powmodMont(mont, base, limbsToBits(e), 0);
+    };
+    if(p[0] % 4 == 3) {
+        limbs e = p;
+        addLimbsAt(e, limbs{1}, 0);
+        divLimbsSmall(e, 4);
+        r = power(A, e);
+    } else if(p[0] % 8 == 5) {
+        limbs e = p, two_a = A;
+        subLimbs(e, limbs{5});
+        divLimbsSmall(e, 8);
+        mont.add(two_a, A);
+        limbs b = power(two_a, e);
+        limbs i = mont.mul(two_a, mont.mul(b, b));
+        mont.sub(i, mont.one);
+        r = mont.mul(mont.mul(A, b), i);
+    } else {
+        limbs q = p;
+        subLimbs(q, limbs{1});
+        size_t s = removeTwos(q);
+        size_t bits = limbsToBits(p).size();
+        if(s * s <= 4 * bits) {
+            // Tonelli-Shanks: invariant x^2 = a*t, with t of order 2^i, i < m
+            limbs z = {2};
+            while(jacobiLimbs(z, p) != -1)
+                addLimbsAt(z, limbs{1}, 0);
+            limbs c = power(mont.to(z), q), e = q, t = power(A, q), b;
+            addLimbsAt(e, limbs{1}, 0);
+            divLimbsSmall(e, 2);
+            r = power(A, e);
+            size_t m = s;
+            while(t != mont.one) {
+                size_t i = 0;
+                for(limbs u = t; u != mont.one; mont.mul(u, u, u))
+                    i++;
+                b = c;
+                for(size_t k = 0; k + i + 1 < m; ++k)
+                    mont.mul(b, b, b);
+                mont.mul(r, b, r);
+                mont.mul(b, b, c);
+                mont.mul(t, c, t);
+                m = i;
+            }
+        } else {
+            // Cipolla: w = t^2 - a a non-residue, r = (t + sqrt(w))^((p+1)/2)
+            limbs t = mont.one, w;
+            while(true) {
+                w = mont.mul(t, t);
+                mont.sub(w, A);
+                limbs plain = mont.from(w);
+                if(!plain.empty() && jacobiLimbs(plain, p) == -1)
+                    break;
+                mont.add(t, mont.one);
+            }
+            limbs e = p;
+            addLimbsAt(e, limbs{1}, 0);
+            divLimbsSmall(e, 2);
+            std::vector<unsigned char> ebits = limbsToBits(e);
+            limbs x = mont.one, y(p.size(), 0), u, v;
+            auto mul = [&](limbs& x1, limbs& y1, const limbs& x2, const limbs& y2) {   // (x1 + y1 s)(x2 + y2 s), s^2 = w
+                u = mont.mul(x1, x2);
+                mont.add(u, mont.mul(mont.mul(y1, y2), w));
+                v = mont.mul(x1, y2);
+                mont.add(v, mont.mul(y1, x2));
+                x1.swap(u);
+                y1.swap(v);
+            };
+            for(size_t k = ebits.size(); k-- > 0; ) {
+                limbs sx = x, sy = y;
+                mul(x, y, sx, sy);
+                if(ebits[k])
+                    mul(x, y, t, mont.one);
+            }
+            r = x;
+        }
+    }
+    r = mont.from(r);
+    limbs other = p;
+    subLimbs(other, r);
+    return compareLimbs(other, r) < 0 ? other : r;
+}
+
+
+//---------------------------------------------------------
+//--------Text conversion in the manner of <charconv>------
+//---------------------------------------------------------
+
+std::to_chars_result bigint::to_chars(char *first, char *last, int base) const {
+    if(base < 2 || base > 36)
+        return {last, std::errc::invalid_argument};
+    if(base == 10) {
+        if(last - first < (std::ptrdiff_t)str.length())
+            return {last, std::errc::value_too_large};
+        return {std::copy(str.begin(), str.end(), first), std::errc()};
+    }
+    bool negative = str[0] == '-';
+    std::string digits = wordsToDigits(limbsToWords(toLimbs(str)), base);
+    if(last - first < (std::ptrdiff_t)(digits.length() + negative))
+        return {last, std::errc::value_too_large};
+    if(negative)
+        *first++ = '-';
+    return {std::copy(digits.begin(), digits.end(), first), std::errc()};
+}
+
+std::from_chars_result bigint::from_chars(const char *first, const char *last, bigint &value, int base) {
+    // an optional '-' and the longest run of digits of base; value is left untouched on error
+    if(base < 2 || base > 36)
+        return {first, std::errc::invalid_argument};
+    const char *p = first;
+    bool negative = p != last && *p == '-';
+    if(negative)
+        ++p;
+    const char *digits = p;
+    while(p != last && digitValue(*p) < base)
+        ++p;
+    if(p == digits)
+        return {first, std::errc::invalid_argument};
+    while(digits + 1 < p && *digits == '0')
+        ++digits;
+    negative = negative && !(p - digits == 1 && *digits == '0');
+    if(base == 10) {
+        value.str.assign(negative ? 1 : 0, '-');
+        value.str.append(digits, p);
+    } else {
+        value.str = fromLimbs(wordsToLimbs(digitsToWords(digits, p - digits, base)), negative);
+    }
+    return {p, std::errc()};
+}
+
+size_t bigint::digits_required(int base) const {
+    if(base == 10 || base < 2 || base > 36)
+        return str.length();
+    size_t digits = str.length() - (str[0] == '-');
+    return (size_t)(digits * (std::log2(10.0) / std::log2((double)base))) + 2 + (str[0] == '-');
+}
+
+
+//---------------------------------------------------------
+//--------Stream input--------------------------------------
+//---------------------------------------------------------
+
+/*
+        ______________________________________________________
+                        Stream Input Function
+        ______________________________________________________
+                      Algorithm Explanation
+
+        operator>> reads straight from the stream buffer, one character at a time, the way
+        num_get does for built-in integers:
+        - the sentry skips leading whitespace (unless noskipws is set).
+        - an optional sign, then, with std::hex, an optional 0x / 0X prefix.
+        - digits of the stream's base (std::dec, std::hex or std::oct) are validated as
+          they are consumed and appended to the result; reading stops at the first
+          character that is not one, which stays in the stream.
+        Nothing is buffered besides the digits themselves. Without a digit the stream gets
+        failbit and the target is left untouched; running out of input sets eofbit.
+
+        Algorithmic Time Complexity : O(n)
+        Algorithmic Space Complexity : O(n)
+*/
+
+std::istream& bigint::readStream(std::istream& stream, bigint& n) {
+    std::istream::sentry sentry(stream);
+    if(!sentry)
+        return stream;
+    std::ios_base::fmtflags flags = stream.flags();
+    int base = (flags & std::ios_base::hex) ? 16 : (flags & std::ios_base::oct) ? 8 : 10;
+    std::streambuf *buf = stream.rdbuf();
+    typedef std::char_traits<char> traits;
+    std::ios_base::iostate state = std::ios_base::goodbit;
+    std::string digits;
+    bool negative = false, prefixZero = false;
+
+    traits::int_type c = buf->sgetc();
+    if(c != traits::eof() && (traits::to_char_type(c) == '-' || traits::to_char_type(c) == '+')) {
+        negative = traits::to_char_type(c) == '-';
+        c = buf->snextc();
+    }
+    if(base == 16 && c != traits::eof() && traits::to_char_type(c) == '0') {
+        c = buf->snextc();
+        if(c != traits::eof() && (traits::to_char_type(c) == 'x' || traits::to_char_type(c) == 'X'))
+            c = buf->snextc();
+        else
+            prefixZero = true;                                      // the 0 was a digit after all
+    }
+    for(; c != traits::eof() && digitValue(traits::to_char_type(c)) < base; c = buf->snextc()) {
+        char d = traits::to_char_type(c);
+        if(digits.empty() && d == '0')
+            prefixZero = true;                                      // leading zeros are dropped as they arrive
+        else
+            digits.push_back(d);
+    }
+    if(c == traits::eof())
+        state |= std::ios_base::eofbit;
+    if(digits.empty() && !prefixZero) {
+        stream.setstate(state | std::ios_base::failbit);
+        return stream;
+    }
+    if(digits.empty()) {
+        n.str = "0";
+    } else if(base == 10) {
+        if(negative)
+            digits.insert(digits.begin(), '-');
+        n.str.swap(digits);
+    } else {
+        n.str = fromLimbs(wordsToLimbs(digitsToWords(digits.data(), digits.size(), base)), negative);
+    }
+    stream.setstate(state);
+    return stream;
+}
+
+
+//---------------------------------------------------------
+//--------Binary import, export and serialization----------
+//---------------------------------------------------------
+
+bigint::byteOrder bigint::nativeByteOrder() {                    // little or big, as the target lays out a word
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__)
+    return __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__ ? byteOrder::big : byteOrder::little;
+#else
+    const std::uint32_t probe = 1;
+    unsigned char first;
+    std::memcpy(&first, &probe, 1);
+    return first == 1 ? byteOrder::little : byteOrder::big;
+#endif
+}
+
+std::vector<unsigned char> bigint::export_bytes(byteOrder order, size_t word_size) const {
+    // count = ceil(bytes / word_size) words, zero padded at the most significant end; empty for 0
+    if(word_size == 0)
+        throw std::invalid_argument("Word size must be positive.");
+    if(order == byteOrder::native)
+        order = nativeByteOrder();
+    words w = limbsToWords(toLimbs(str), threadCount());
+    size_t bytes = (bitLengthWords(w) + 7) / 8;
+    size_t count = (bytes + word_size - 1) / word_size;
+    std::vector<unsigned char> out(count * word_size, 0);
+    for(size_t i = 0; i < bytes; ++i) {                          // byte i of the magnitude, least significant first
+        unsigned char byte = (unsigned char)(w[i/4] >> (8 * (i % 4)));
+        out[order == byteOrder::little ? i : out.size() - 1 - i] = byte;
+    }
+    return out;
+}
+
+bigint bigint::import_bytes(const void *data, size_t count, byteOrder order, size_t word_size) {
+    // count words of word_size bytes, laid out as export_bytes writes them
+    if(word_size == 0)
+        throw std::invalid_argument("Word size must be positive.");
+    if(order == byteOrder::native)
+        order = nativeByteOrder();
+    const unsigned char *in = static_cast<const unsigned char*>(data);
+    size_t bytes = count * word_size;
+    words w((bytes + 3) / 4, 0);
+    for(size_t i = 0; i < bytes; ++i) {
+        unsigned char byte = in[order == byteOrder::little ? i : bytes - 1 - i];
+        w[i/4] |= (std::uint32_t)byte << (8 * (i % 4));
+    }
+    trimLimbs(w);
+    bigint ans;
+    ans.str = fromLimbs(wordsToLimbs(w, threadCount()), false);
+    return ans;
+}
+
+std::vector<unsigned char> bigint::serialize() const {
+    words w = limbsToWords(toLimbs(str), threadCount());
+    std::vector<unsigned char> out;
+    out.reserve(10 + 4 * w.size());
+    std::uint64_t header = (std::uint64_t)w.size() << 1 | (str[0] == '-' && !w.empty());
+    do {
+        out.push_back((unsigned char)((header & 0x7F) | (header > 0x7F ? 0x80 : 0)));
+        header >>= 7;
+    } while(header);
+    for(size_t i = 0; i < w.size(); ++i)
+        for(int k = 0; k < 4; ++k)
+            out.push_back((unsigned char)(w[i] >> (8 * k)));
+    return out;
+}
+
+const unsigned char* bigint::recordHeader(const unsigned char* p, const unsigned char* last, std::uint64_t& count, bool& negative) {
+    // decodes the header of the record at p, returns where its words start; throws if the record is malformed
+    std::uint64_t header = 0;
+    for(int shift = 0; ; shift += 7) {
+        if(p == last || shift > 63)
+            throw std::runtime_error("Malformed serialized bigint.");
+        header |= (std::uint64_t)(*p & 0x7F) << shift;
+        if(!(*p++ & 0x80))
+            break;
+    }
+    count = header >> 1;
+    negative = header & 1;
+    if(count > (std::uint64_t)(last - p) / 4 || (count > 0 && p[4*count - 1] == 0 && p[4*count - 2] == 0
+        && p[4*count - 3] == 0 && p[4*count - 4] == 0) || (count == 0 && negative))
+        throw std::runtime_error("Malformed serialized bigint.");
+    return p;
+}
+
+bigint bigint::deserialize(const unsigned char *&first, const unsigned char *last) {
+    // reads one record at first and advances first past it; throws on truncated or malformed input
+    view v(first, last);
+    bigint ans(v);
+    first += v.bytes();
+    return ans;
+}
+
+bigint::bigint(view const &v) {
+    words w(v.size());
+    for(size_t i = 0; i < w.size(); ++i)
+        w[i] = v.word(i);
+    str = fromLimbs(wordsToLimbs(w, threadCount()), v.negative());
+}
+
+
+//---------------------------------------------------------
+//--------Record views and memory mapped files-------------
+//---------------------------------------------------------
+
+bigint::view::view(const unsigned char *first, const unsigned char *last) : record(first) {
+    std::uint64_t n;
+    payload = recordHeader(first, last, n, neg);
+    count = n;
+    end = payload + 4 * count;
+}
+
+std::uint32_t bigint::view::word(size_t i) const {
+    const unsigned char *p = payload + 4 * i;
+    return (std::uint32_t)p[0] | (std::uint32_t)p[1] << 8 | (std::uint32_t)p[2] << 16 | (std::uint32_t)p[3] << 24;
+}
+
+int bigint::view::compare(const view &b) const {
+    if(neg != b.neg)
+        return neg ? -1 : 1;
+    int sign = neg ? -1 : 1;
+    if(count != b.count)
+        return count < b.count ? -sign : sign;
+    for(size_t i = count; i-- > 0; ) {
+        std::uint32_t x = word(i), y = b.word(i);
+        if(x != y)
+            return x < y ? -sign : sign;
+    }
+    return 0;
+}
+
+int bigint::view::compare(bigint const &b) const {
+    bool bneg = b.str[0] == '-' && b.str != "-0";
+    words w = limbsToWords(toLimbs(b.str));
+    if(w.empty())
+        bneg = false;
+    if(neg != bneg)
+        return neg ? -1 : 1;
+    int sign = neg ? -1 : 1;
+    if(count != w.size())
+        return count < w.size() ? -sign : sign;
+    for(size_t i = count; i-- > 0; ) {
+        std::uint32_t x = word(i);
+        if(x != w[i])
+            return x < w[i] ? -sign : sign;
+    }
+    return 0;
+}
+
+bigint::mappedFile::mappedFile(std::string const &path) {
+#ifdef BIGINT_POSIX_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0)
+        throw std::runtime_error("Cannot open " + path + ".");
+    struct stat st;
+    if(::fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw std::runtime_error("Cannot stat " + path + ".");
+    }
+    length = (size_t)st.st_size;
+    if(length > 0) {
+        void *p = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(p == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error("Cannot map " + path + ".");
+        }
+        base = static_cast<const unsigned char*>(p);
+    }
+    ::close(fd);
+#else
+    std::ifstream in(path, std::ios::binary);
+    if(!in)
+        throw std::runtime_error("Cannot open " + path + ".");
+    buffer.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    base = buffer.data();
+    length = buffer.size();
+#endif
+}
+
+bigint::mappedFile::~mappedFile() {
+#ifdef BIGINT_POSIX_MMAP
+    if(base)
+        ::munmap(const_cast<unsigned char*>(base), length);
+#endif
+}
+
+bool bigint::mappedFile::indexUpTo(size_t i) const {            // true if record i exists
+    while(offsets.size() <= i && scanned < length) {
+        view v(base + scanned, base + length);
+        offsets.push_back(scanned);
+        scanned += v.bytes();
+    }
+    return offsets.size() > i;
+}
+
+bool bigint::mappedFile::locate(size_t i, size_t& offset) const {   // offset of record i, false past the end
+    std::lock_guard<std::mutex> hold(guard);
+    if(!indexUpTo(i))
+        return false;
+    offset = offsets[i];
+    return true;
+}
+
+size_t bigint::mappedFile::size() const {
+    std::lock_guard<std::mutex> hold(guard);
+    indexUpTo((size_t)-2);
+    return offsets.size();
+}
+
+bigint::view bigint::mappedFile::operator[](size_t i) const {
+    size_t offset = 0;
+    locate(i, offset);
+    return view(base + offset, base + length);
+}
+
+bigint::view bigint::mappedFile::at(size_t i) const {
+    size_t offset;
+    if(!locate(i, offset))
+        throw std::out_of_range("Record index is past the end of the file.");
+    return view(base + offset, base + length);
+}
+
+
+//---------------------------------------------------------
+//--------Range algorithms---------------------------------
+//---------------------------------------------------------
+
+template<class It> void bigint::_big_sort(It first, It last) {
+    size_t n = std::distance(first, last);
+    if(n < SORT_RADIX_THRESHOLD) {
+        std::sort(first, last, [](bigint const &a, bigint const &b) { return compareDecimal(a.str, b.str) < 0; });
+        return;
+    }
+    std::vector<const std::string*> values(n);
+    It it = first;
+    for(size_t k = 0; k < n; ++k, ++it)
+        values[k] = &it->str;
+    std::vector<size_t> order = sortPermutation(values);
+    std::vector<bigint> sorted;
+    sorted.reserve(n);
+    for(size_t k = 0; k < n; ++k)
+        sorted.push_back(std::move(first[order[k]]));
+    std::move(sorted.begin(), sorted.end(), first);
+}
+
+template<class It> void bigint::_big_parallelSort(It first, It last) {
+    size_t n = std::distance(first, last);
+    size_t threads = std::min<size_t>(threadCount(), n / SORT_RADIX_THRESHOLD);
+    if(threads <= 1) {
+        _big_sort(first, last);
+        return;
+    }
+    std::vector<size_t> bounds(threads + 1);
+    for(size_t t = 0; t <= threads; ++t)
+        bounds[t] = n * t / threads;
+    std::vector<std::future<void>> pending;
+    for(size_t t = 0; t < threads; ++t)
+        pending.push_back(std::async(std::launch::async, [=]() { _big_sort(first + bounds[t], first + bounds[t+1]); }));
+    for(std::future<void> &f : pending)
+        f.get();
+    auto less = [](bigint const &a, bigint const &b) { return compareDecimal(a.str, b.str) < 0; };
+    for(size_t width = 1; width < threads; width *= 2) {            // merge neighbouring sorted slices pairwise
+        pending.clear();
+        for(size_t t = 0; t + width < threads; t += 2 * width) {
+            size_t lo = bounds[t], mid = bounds[t + width], hi = bounds[std::min(t + 2 * width, threads)];
+            pending.push_back(std::async(std::launch::async, [=]() { std::inplace_merge(first + lo, first + mid, first + hi, less); }));
+        }
+        for(std::future<void> &f : pending)
+            f.get();
+    }
+}
+
+
+//---------------------------------------------------------
+//--------Bit queries---------------------------------------
+//---------------------------------------------------------
+
+size_t bigint::bit_length() const {
+    return bitLengthWords(limbsToWords(toLimbs(str)));
+}
+
+size_t bigint::popcount() const {
+    words w = limbsToWords(toLimbs(str));
+    size_t count = 0;
+    for(size_t i = 0; i < w.size(); ++i)
+        count += __builtin_popcount(w[i]);
+    return count;
+}
+
+bool bigint::test_bit(size_t i) const {
+    // the bit of -m is the complement of the bit of m - 1
+    bool negative = signDecimal(str) < 0;
+    if(i < 9 && !negative)
+        return (lowNineBits(str) >> i) & 1;
+    words w = limbsToWords(toLimbs(str));
+    if(negative)
+        decrementWords(w);
+    bool bit = i / 32 < w.size() && ((w[i/32] >> (i % 32)) & 1);
+    return bit != negative;
+}
+
+void bigint::set_bit(size_t i) {
+    // for -m the bit is cleared in m - 1 instead
+    bool negative = signDecimal(str) < 0;
+    words w = limbsToWords(toLimbs(str));
+    if(negative)
+        decrementWords(w);
+    if(w.size() <= i / 32) {
+        if(negative)
+            return;                                             // already set in the sign extension
+        w.resize(i / 32 + 1, 0);
+    }
+    if(negative)
+        w[i/32] &= ~(1u << (i % 32));
+    else
+        w[i/32] |= 1u << (i % 32);
+    trimLimbs(w);
+    if(negative)
+        addWordsAt(w, words(1, 1), 0);
+    str = fromLimbs(wordsToLimbs(w, threadCount()), negative);
+}
+
+void bigint::clear_bit(size_t i) {
+    // for -m the bit is set in m - 1 instead
+    bool negative = signDecimal(str) < 0;
+    words w = limbsToWords(toLimbs(str));
+    if(negative)
+        decrementWords(w);
+    if(w.size() <= i / 32) {
+        if(!negative)
+            return;                                             // already clear
+        w.resize(i / 32 + 1, 0);
+    }
+    if(negative)
+        w[i/32] |= 1u << (i % 32);
+    else
+        w[i/32] &= ~(1u << (i % 32));
+    trimLimbs(w);
+    if(negative)
+        addWordsAt(w, words(1, 1), 0);
+    str = fromLimbs(wordsToLimbs(w, threadCount()), negative && !w.empty());
+}
+
+size_t bigint::count_trailing_zeros() const {
+    std::uint32_t low = lowNineBits(str);
+    if(low != 0)
+        return __builtin_ctz(low);
+    return scan1(0);
+}
+
+size_t bigint::scan1(size_t from) const {
+    // -m has ones exactly where m - 1 has zeros
+    bool negative = signDecimal(str) < 0;
+    words w = limbsToWords(toLimbs(str));
+    if(negative)
+        decrementWords(w);
+    for(size_t k = from / 32; k < w.size() || negative; ++k) {
+        std::uint32_t word = k < w.size() ? w[k] : 0;
+        if(negative)
+            word = ~word;
+        if(k == from / 32)
+            word &= ~0u << (from % 32);
+        if(word)
+            return 32 * k + __builtin_ctz(word);
+    }
+    return npos;
+}
+
+
+//---------------------------------------------------------
+//--------Floating point conversion------------------------
+//---------------------------------------------------------
+
+/*
+        ______________________________________________________
+                     Floating Point Conversion
+        ______________________________________________________
+                      Algorithm Explanation
+
+        A value of D > 38 digits is written as x = (H + f) * 10^E, where H holds the
+        leading 36 digits, E = D - 36 and 0 <= f < 1, so that x = (H + f) * 5^E * 2^E.
+        Binary powering with every product cut to its top 128 bits gives 5^E from below
+        (cuts rounded down) and from above (cuts rounded up). Then
+            H * 5^E_low * 2^E  <=  x  <  (H + 1) * 5^E_high * 2^E
+        are two 128 bit numbers a relative 10^-35 apart. Rounding is monotone, so when
+        both bounds round to the same double, that is the correctly rounded x.
+        They round apart only when x lies that close to a halfway point. Then the exact
+        magnitude is converted to words and its top 128 bits are kept, with any lower
+        set bit folded into bit 0 to decide ties. The final scaling by a power of two is
+        exact, or overflows to infinity.
+
+        Algorithmic Time Complexity : O(log D) products of 128 bit numbers, O(M(n) log n)
+                                      in the rare exact case
+        Algorithmic Space Complexity : O(1), O(n) in the exact case
+*/
+
+unsigned __int128 bigint::mulTop(unsigned __int128 a, unsigned __int128 b, bool up, long long& e) {   // a*b >= 2^128 cut to 128 bits, e gains the bits cut
+    std::uint64_t a0 = (std::uint64_t)a, a1 = (std::uint64_t)(a >> 64), b0 = (std::uint64_t)b, b1 = (std::uint64_t)(b >> 64);
+    unsigned __int128 p00 = (unsigned __int128)a0 * b0, p01 = (unsigned __int128)a0 * b1;
+    unsigned __int128 p10 = (unsigned __int128)a1 * b0, p11 = (unsigned __int128)a1 * b1;
+    unsigned __int128 mid = (p00 >> 64) + (std::uint64_t)p01 + (std::uint64_t)p10;
+    unsigned __int128 lo = (mid << 64) | (std::uint64_t)p00;
+    unsigned __int128 hi = p11 + (p01 >> 64) + (p10 >> 64) + (mid >> 64);
+    int lz = (hi >> 64) ? __builtin_clzll((std::uint64_t)(hi >> 64)) : 64 + __builtin_clzll((std::uint64_t)hi);
+    unsigned __int128 top = lz ? (hi << lz) | (lo >> (128 - lz)) : hi;
+    bool cut = (lz ? lo << lz : lo) != 0;
+    e += 128 - lz;
+    if(up && cut && ++top == 0) {
+        top = (unsigned __int128)1 << 127;
+        e++;
+    }
+    return top;
+}
+
+template<class T> T bigint::toFloating(const std::string& s) {
+    size_t i = s[0] == '-';
+    bool negative = i;
+    while(i + 1 < s.length() && s[i] == '0')
+        i++;
+    size_t digits = s.length() - i;
+    auto scale = [](unsigned __int128 m, long long e) {
+        return std::ldexp((T)m, (int)std::min<long long>(e, 1 << 20));
+    };
+    T result;
+    if(digits <= 38) {                                  // below 2^127: exact in 128 bits
+        unsigned __int128 m = 0;
+        for(; i < s.length(); ++i)
+            m = m*10 + (unsigned)(s[i] - '0');
+        result = (T)m;
+        return negative ? -result : result;
+    }
+    unsigned __int128 head = 0;
+    for(size_t k = 0; k < 36; ++k)
+        head = head*10 + (unsigned)(s[i + k] - '0');
+    size_t E = digits - 36;
+    unsigned __int128 low = (unsigned __int128)1 << 127, high = low, base_low = (unsigned __int128)5 << 125, base_high = base_low;
+    long long e_low = -127, e_high = -127, e_base_low = -125, e_base_high = -125;
+    for(size_t k = E; k > 0; k >>= 1) {
+        if(k & 1) {
+            e_low += e_base_low;
+            low = mulTop(low, base_low, false, e_low);
+            e_high += e_base_high;
+            high = mulTop(high, base_high, true, e_high);
+        }
+        if(k > 1) {
+            e_base_low += e_base_low;
+            base_low = mulTop(base_low, base_low, false, e_base_low);
+            e_base_high += e_base_high;
+            base_high = mulTop(base_high, base_high, true, e_base_high);
+        }
+    }
+    e_low += E;
+    e_high += E;
+    low = mulTop(head, low, false, e_low);
+    high = mulTop(head + 1, high, true, e_high);
+    result = scale(low, e_low);
+    if(result != scale(high, e_high)) {                 // near a halfway point: decide on the exact bits
+        words w = limbsToWords(toLimbs(s), threadCount());
+        size_t bits = bitLengthWords(w), shift = bits > 128 ? bits - 128 : 0, q = shift / 32, r = shift % 32;
+        unsigned __int128 m = 0;
+        for(size_t k = w.size(); k-- > q + 1; )
+            m = (m << 32) | w[k];
+        m = (m << (32 - r)) | (w[q] >> r);
+        bool sticky = (w[q] & ((1u << r) - 1)) != 0;
+        for(size_t k = 0; k < q && !sticky; ++k)
+            sticky = w[k] != 0;
+        result = scale(m | sticky, (long long)shift);
+    }
+    return negative ? -result : result;
+}
+
+double bigint::to_double() const {
+    return toFloating<double>(str);
+}
+
+long double bigint::to_long_double() const {
+    return toFloating<long double>(str);
+}
+
+bool bigint::try_to_int64(std::int64_t& out) const {
+    if(compareSmall(str, std::numeric_limits<std::int64_t>::max()) > 0 || compareSmall(str, std::numeric_limits<std::int64_t>::min()) < 0)
+        return false;
+    std::uint64_t m = 0;
+    for(size_t i = str[0] == '-'; i < str.length(); ++i)
+        m = m*10 + (str[i] - '0');
+    out = str[0] == '-' ? (std::int64_t)(0 - m) : (std::int64_t)m;
+    return true;
+}
+
+std::string bigint::fromFloating(long double d) {              // the integer part of d, exactly
+    if(!std::isfinite(d))
+        throw std::runtime_error("Invalid Big Integer has been fed.");
+    int e;
+    long double m = std::frexp(std::fabs(std::trunc(d)), &e);   // |trunc(d)| = m * 2^e, 1/2 <= m < 1
+    words w;
+    while(m != 0) {                                     // the mantissa, 32 bits at a time from the top
+        m = std::ldexp(m, 32);
+        std::uint32_t chunk = (std::uint32_t)m;
+        w.insert(w.begin(), chunk);
+        m -= chunk;
+        e -= 32;
+    }
+    std::string s = fromLimbs(wordsToLimbs(w), false);
+    s = e >= 0 ? shiftLeft(s, e) : shiftRight(s, -e);
+    if(d < 0 && s != "0")
+        s.insert(s.begin(), '-');
+    return s;
+}
+
+
+//---------------------------------------------------------
+//--------Hashing------------------------------------------
+//---------------------------------------------------------
+
+/*
+        ______________________________________________________
+                     Hashing and Fingerprints
+        ______________________________________________________
+                      Algorithm Explanation
+
+        Both read the canonical magnitude digits, past the sign and any leading zeros, so
+        every spelling of a value hashes alike. The sign counts only for nonzero values.
+        hash() takes the digits 16 bytes at a time as two 64 bit words and folds each pair
+        into the state with one 64 x 64 -> 128 bit multiply, xoring its halves. A murmur3
+        finalizer then spreads every input bit into the low bits that pick buckets.
+        fingerprint() is the value mod the Mersenne prime p = 2^61 - 1, by Horner's rule
+        over blocks of 16 digits: f = f * 10^16 + block. Reducing the 122 bit product mod p
+        is a shift, a mask and an add. Equal values have equal fingerprints, so differing
+        fingerprints prove inequality.
+
+        Algorithmic Time Complexity : O(n), one multiply per 16 digits
+        Algorithmic Space Complexity : O(1)
+*/
+
+std::uint64_t bigint::mixBits(std::uint64_t h) {                // murmur3 finalizer
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+std::uint64_t bigint::mulModMersenne61(std::uint64_t a, std::uint64_t b) {   // a * b mod 2^61 - 1, for a, b < 2^61
+    const std::uint64_t P = ((std::uint64_t)1 << 61) - 1;
+    unsigned __int128 r = (unsigned __int128)a * b;
+    std::uint64_t x = ((std::uint64_t)r & P) + (std::uint64_t)(r >> 61);
+    return x >= P ? x - P : x;
+}
+
+size_t bigint::hash() const {
+    size_t i = str[0] == '-';
+    bool negative = i;
+    while(i + 1 < str.length() && str[i] == '0')
+        i++;
+    if(i + 1 == str.length() && str[i] == '0')
+        negative = false;
+    const char *p = str.data() + i;
+    size_t n = str.length() - i;
+    auto fold = [](std::uint64_t a, std::uint64_t b) {
+        unsigned __int128 r = (unsigned __int128)a * b;
+        return (std::uint64_t)r ^ (std::uint64_t)(r >> 64);
+    };
+    std::uint64_t h = fold((n * 2 + negative) ^ 0x9E3779B97F4A7C15ull, 0x8EBC6AF09C88C6E3ull);   // length and sign, scrambled so no digit cancels them
+    for(; n >= 16; p += 16, n -= 16) {
+        std::uint64_t a, b;
+        std::memcpy(&a, p, 8);
+        std::memcpy(&b, p + 8, 8);
+        h = fold(a ^ h ^ 0xA0761D6478BD642Full, b ^ 0xE7037ED1A0B428DBull);
+    }
+    std::uint64_t a = 0, b = 0;                         // the last 0..15 digits
+    std::memcpy(&a, p, std::min<size_t>(n, 8));
+    if(n > 8)
+        std::memcpy(&b, p + 8, n - 8);
+    h = fold(a ^ h ^ 0xA0761D6478BD642Full, b ^ 0xE7037ED1A0B428DBull);
+    return (size_t)mixBits(h);
+}
+
+std::uint64_t bigint::fingerprint() const {
+    const std::uint64_t P = ((std::uint64_t)1 << 61) - 1;
+    const std::uint64_t BLOCK = 10000000000000000ull;  // 10^16
+    size_t i = str[0] == '-';
+    bool negative = i;
+    size_t n = str.length() - i;
+    std::uint64_t f = 0;
+    for(size_t head = n % 16; head > 0; --head, ++i)    // the leading digits short of a full block
+        f = f*10 + (str[i] - '0');
+    for(; i < str.length(); i += 16) {
+        std::uint64_t block = (std::uint64_t)parseEightDigits(&str[i]) * 100000000 + parseEightDigits(&str[i + 8]);
+        f = mulModMersenne61(f, BLOCK) + block;        // < 2^61 + 10^16, one subtraction reduces it
+        f = f >= P ? f - P : f;
+    }
+    return negative && f != 0 ? P - f : f;
+}
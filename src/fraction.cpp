@@ -17,7 +17,7 @@ Fraction addFrac(Fraction x, Fraction y) {
 // Reduce by GCD
 Fraction normalize(Fraction f) {
     BigInt g = big_gcd(f.first, f.second);
-    return { f.first / g,
-             f.second / g };
+    return { big_divexact(f.first, g),
+             big_divexact(f.second, g) };
 }
 
@@ -4,6 +4,11 @@
 #include "fraction.h"
 #include "../src/fraction.cpp"
 #include <limits>
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <unordered_map>
+#include <unordered_set>
 
 //Addition
 TEST_CASE("addFrac: 1/2 + 1/3 == 5/6") {
@@ -58,3 +63,710 @@ TEST_CASE("addFrac is commutative") {
 
 
 
+//Exact division
+TEST_CASE("big_divexact matches division when the divisor divides") {
+    BigInt a("123456789012345678901234567890");
+    BigInt b("9876543210987654321");
+    BigInt p = a * b;
+    BigInt q1 = big_divexact(p, b);
+    BigInt q2 = big_divexact(p, a);
+    CHECK(q1 == a);
+    CHECK(q2 == b);
+    BigInt q3 = big_divexact(BigInt("-1024000000000000000000"), BigInt("2048"));
+    BigInt q4 = big_divexact(BigInt("30517578125000"), BigInt("-78125"));
+    BigInt q5 = big_divexact(BigInt("0"), BigInt("7"));
+    CHECK(q3 == BigInt("-500000000000000000"));
+    CHECK(q4 == BigInt("-390625000"));
+    CHECK(q5 == BigInt("0"));
+    CHECK_THROWS(big_divexact(a, BigInt("0")));
+}
+
+//lcm through exact division
+TEST_CASE("big_lcm") {
+    BigInt a("123456789012345678900"), b("98765432109876543210");
+    BigInt c("4"), d("6");
+    BigInt l1 = big_lcm(a, b);
+    BigInt l2 = big_lcm(c, d);
+    CHECK(l1 == BigInt("13548070124980948012362614100"));
+    CHECK(l2 == BigInt("12"));
+}
+
+//Factorial through the prime swing engine
+TEST_CASE("big_fact") {
+    BigInt zero("0"), small("20"), mid("25"), large("100"), neg("-3");
+    BigInt f0 = big_fact(zero), f20 = big_fact(small), f25 = big_fact(mid), f100 = big_fact(large);
+    CHECK(f0 == BigInt("1"));
+    CHECK(f20 == BigInt("2432902008176640000"));
+    CHECK(f25 == BigInt("15511210043330985984000000"));
+    CHECK(f100 == BigInt("93326215443944152681699238856266700490715968264381621468592963895217599993229915608941463976156518286253697920827223758251185210916864000000000000000000000000"));
+    CHECK_THROWS(big_fact(neg));
+}
+
+//Product of a range, split over threads
+TEST_CASE("big_productRange and threaded big_fact") {
+    BigInt lo("5"), hi("9"), nlo("-7"), nhi("-3"), n("30000");
+    BigInt p1 = big_productRange(lo, hi), p2 = big_productRange(nlo, nhi), p3 = big_productRange(nlo, hi);
+    CHECK(p1 == BigInt("15120"));
+    CHECK(p2 == BigInt("-2520"));
+    CHECK(p3 == BigInt("0"));
+    BigInt even = big_productRange(BigInt("-12"), BigInt("-9")), far("-100000000000000000000000"), minusOne("-1");
+    CHECK(even == BigInt("11880"));
+    CHECK_THROWS_AS(big_productRange(far, minusOne), std::runtime_error);
+    BigInt serial = big_fact(n);
+    big_setThreads(4);
+    BigInt threaded = big_fact(n);
+    BigInt one("1");
+    BigInt range = big_productRange(one, n);
+    big_setThreads(1);
+    CHECK(threaded == serial);
+    CHECK(range == serial);
+}
+
+//Primality: deterministic below 2^64, BPSW above
+TEST_CASE("big_isPrime") {
+    BigInt m127("170141183460469231731687303715884105727");
+    BigInt semi("10000000000000000016800000000000000005031");
+    BigInt spsp("3215031751"), carmichael("561"), p64("18446744073709551557");
+    BigInt one("1"), two("2"), neg("-7");
+    CHECK(big_isPrime(m127));
+    CHECK(big_isPrime(m127, 5));
+    CHECK_FALSE(big_isPrime(semi));
+    CHECK_FALSE(big_isPrime(spsp));
+    CHECK_FALSE(big_isPrime(carmichael));
+    CHECK(big_isPrime(p64));
+    CHECK(big_isPrime(two));
+    CHECK_FALSE(big_isPrime(one));
+    CHECK_FALSE(big_isPrime(neg));
+}
+
+//Modular exponentiation
+TEST_CASE("big_powmod") {
+    BigInt r1 = big_powmod(BigInt("3"), BigInt("100000000000000000000"), BigInt("1000000000000000000000000000057"));
+    BigInt r2 = big_powmod(BigInt("-2"), BigInt("3"), BigInt("5"));
+    CHECK(r1 == BigInt("432022735502812758199986491015"));
+    CHECK(r2 == BigInt("2"));
+    CHECK_THROWS(big_powmod(BigInt("2"), BigInt("-1"), BigInt("5")));
+}
+
+//Trial division against the small-prime table
+TEST_CASE("big_trialDivide") {
+    BigInt a("100000000000000000039"), b("9999999967");
+    BigInt composite = a * BigInt("65521"), prime = a;
+    CHECK(big_trialDivide(composite, 65536) == 65521);
+    CHECK(big_trialDivide(composite, 65520) == 0);
+    CHECK(big_trialDivide(prime, 100000) == 0);
+    CHECK(big_trialDivide(b * BigInt("70001"), 80000) == 70001);
+    CHECK(big_trialDivide(BigInt("91"), 10) == 7);
+    BigInt far = b * BigInt("1000003");                 // past the first streamed window
+    CHECK(big_trialDivide(far, 1000003) == 1000003);
+    CHECK(big_trialDivide(far, 1000002) == 0);
+}
+
+TEST_CASE("big_factor") {
+    auto str = [](const std::vector<BigInt>& v) {
+        std::ostringstream s;
+        for(const BigInt& x : v)
+            s << x << " ";
+        return s.str();
+    };
+    CHECK(str(big_factor(BigInt("-360"))) == "-1 2 2 2 3 3 5 ");
+    CHECK(str(big_factor(BigInt("1"))).empty());
+    CHECK(str(big_factor(BigInt("147573952589676412927"))) == "193707721 761838257287 ");
+    CHECK_THROWS(big_factor(BigInt("0")));
+
+    BigInt big("100000000000000000000000000319");
+    BigInt rho = BigInt("10000019") * BigInt("30000001") * big * BigInt("65521");
+    CHECK(str(big_factor(rho)) == "65521 10000019 30000001 100000000000000000000000000319 ");
+
+    bigint::factorOptions options;
+    options.rhoIterations = 0;
+    options.ecmCurves = 0;
+    BigInt pm1 = BigInt("500843987887548043847") * big;                  // p-1 is 30000-smooth
+    CHECK(str(big_factor(pm1, options)) == "500843987887548043847 100000000000000000000000000319 ");
+
+    options.pm1B1 = 0;
+    options.ecmCurves = 200;
+    options.ecmB1 = 2000;
+    options.ecmB2 = 200000;
+    BigInt ecm = BigInt("123456789059") * big;
+    CHECK(str(big_factor(ecm, options)) == "123456789059 100000000000000000000000000319 ");
+
+    options.ecmCurves = 0;
+    CHECK(str(big_factor(ecm, options)) == str(std::vector<BigInt>{ecm}));
+}
+
+TEST_CASE("big_nextPrime, big_prevPrime and big_primeRange") {
+    BigInt a = big_nextPrime(BigInt("100000000000000000000")), b = big_prevPrime(BigInt("100000000000000000000"));
+    CHECK(a == BigInt("100000000000000000039"));
+    CHECK(b == BigInt("99999999999999999989"));
+    BigInt c = big_nextPrime(BigInt("18446744073709551557")), d = big_nextPrime(BigInt("-7"));
+    CHECK(c == BigInt("18446744073709551629"));
+    CHECK(d == BigInt("2"));
+    BigInt e = big_prevPrime(BigInt("3"));
+    CHECK(e == BigInt("2"));
+    CHECK_THROWS(big_prevPrime(BigInt("2")));
+
+    std::ostringstream small;
+    for(const BigInt& p : big_primeRange(BigInt("-5"), BigInt("30")))
+        small << p << " ";
+    CHECK(small.str() == "2 3 5 7 11 13 17 19 23 29 ");
+
+    int count = 0;
+    BigInt last;
+    for(const BigInt& p : big_primeRange(BigInt("100000000000000000000"), BigInt("100000000000000010000"))) {
+        count++;
+        last = p;
+    }
+    CHECK(count == 205);
+    CHECK(last == big_prevPrime(BigInt("100000000000000010000")));
+    CHECK(big_primeRange(BigInt("24"), BigInt("29")).begin() == big_primeRange(BigInt("24"), BigInt("29")).end());
+}
+
+TEST_CASE("big_fib, big_lucas and big_binomial") {
+    BigInt f100 = big_fib(BigInt("100")), f0 = big_fib(BigInt("0")), fneg = big_fib(BigInt("-10"));
+    CHECK(f100 == BigInt("354224848179261915075"));
+    CHECK(f0 == BigInt("0"));
+    CHECK(fneg == BigInt("-55"));
+    BigInt l100 = big_lucas(BigInt("100")), l0 = big_lucas(BigInt("0")), lneg = big_lucas(BigInt("-5"));
+    CHECK(l100 == BigInt("792070839848372253127"));
+    CHECK(l0 == BigInt("2"));
+    CHECK(lneg == BigInt("-11"));
+
+    BigInt f1000 = big_fib(BigInt("1000")), l1000 = big_lucas(BigInt("1000"));
+    BigInt f999 = big_fib(BigInt("999")), f1001 = big_fib(BigInt("1001"));
+    BigInt sum = f999 + f1001;
+    CHECK(l1000 == sum);                                            // L(n) = F(n-1) + F(n+1)
+    BigInt g = big_gcd(f1000, f999);
+    CHECK(g == BigInt("1"));
+
+    BigInt c = big_binomial(BigInt("100"), BigInt("50")), c0 = big_binomial(BigInt("7"), BigInt("9"));
+    BigInt cneg = big_binomial(BigInt("-4"), BigInt("3")), ck = big_binomial(BigInt("10"), BigInt("-1"));
+    CHECK(c == BigInt("100891344545564193334812497256"));
+    CHECK(c0 == BigInt("0"));
+    CHECK(cneg == BigInt("-20"));
+    CHECK(ck == BigInt("0"));
+
+    BigInt n("300"), k("123"), nk("177");
+    BigInt binom = big_binomial(n, k);
+    BigInt fn = big_fact(n), fk = big_fact(k), fnk = big_fact(nk);
+    BigInt expected = big_divexact(fn, fk * fnk);
+    CHECK(binom == expected);
+
+    BigInt small = big_binomial(BigInt("100000000"), BigInt("3"));
+    CHECK(small == BigInt("166666661666666700000000"));
+    BigInt whole = big_binomial(BigInt("5000"), BigInt("2049"));                  // Kummer, from both sides of the switch
+    BigInt left = big_binomial(BigInt("4999"), BigInt("2048")), right = big_binomial(BigInt("4999"), BigInt("2049"));
+    CHECK(whole == left + right);
+}
+
+TEST_CASE("big_crt and bigint::crtBasis") {
+    BigInt x = big_crt({BigInt("2"), BigInt("3"), BigInt("2")}, {BigInt("3"), BigInt("5"), BigInt("7")});
+    CHECK(x == BigInt("23"));
+    BigInt y = big_crt({BigInt("-1"), BigInt("0")}, {BigInt("1000000007"), BigInt("998244353")});
+    CHECK(y == BigInt("993328913953302348"));                          // = -1 mod p, 0 mod q
+    CHECK_THROWS(big_crt({BigInt("1"), BigInt("1")}, {BigInt("4"), BigInt("6")}));
+    CHECK_THROWS(big_crt({BigInt("1")}, {BigInt("0")}));
+
+    bigint::crtBasis basis({BigInt("1000000007"), BigInt("1000000009"), BigInt("340282366920938463463374607431768211297")});
+    BigInt value("123456789012345678901234567890123456789012345678901234567");
+    std::vector<BigInt> r = basis.reduce(value);
+    BigInt back = basis.combine(r), mod = basis.modulus();
+    CHECK(back == value % mod);
+}
+
+TEST_CASE("bigint::rnsInt") {
+    auto basis = std::make_shared<bigint::rnsBasis>(512);
+    BigInt a("-98765432109876543210987654321"), b("12345678901234567890123456789"), c("-7");
+    bigint::rnsInt ra(basis, a), rb(basis, b), rc(basis, c);
+    BigInt got = ((ra * rb - rc) * (ra + rb) - rb * rb).toBigint();
+    BigInt expected = (a * b - c) * (a + b) - b * b;
+    CHECK(got == expected);
+    BigInt neg = (-ra).toBigint(), zero = (ra - ra).toBigint();
+    CHECK(neg == BigInt("98765432109876543210987654321"));
+    CHECK(zero == BigInt("0"));
+    CHECK(ra * rb == rb * ra);
+    CHECK_THROWS(ra + bigint::rnsInt(std::make_shared<bigint::rnsBasis>(512), a));
+}
+
+TEST_CASE("big_jacobi, big_kronecker and big_sqrtmod") {
+    CHECK(big_jacobi(BigInt("1001"), BigInt("9907")) == -1);
+    CHECK(big_jacobi(BigInt("19"), BigInt("45")) == 1);
+    CHECK(big_jacobi(BigInt("-1"), BigInt("7")) == -1);
+    CHECK(big_jacobi(BigInt("15"), BigInt("45")) == 0);
+    CHECK_THROWS(big_jacobi(BigInt("3"), BigInt("4")));
+    CHECK(big_legendre(BigInt("2"), BigInt("998244353")) == 1);
+    CHECK(big_kronecker(BigInt("5"), BigInt("8")) == -1);
+    CHECK(big_kronecker(BigInt("-1"), BigInt("-1")) == -1);
+    CHECK(big_kronecker(BigInt("6"), BigInt("4")) == 0);
+
+    for (const char *p : {"1000000007", "998244353", "170141183460469231731687303715884105727", "13"}) {
+        BigInt prime(p), a("123456789123456789");
+        BigInt square = a * a % prime;
+        BigInt r = big_sqrtmod(square, prime);
+        BigInt back = r * r % prime;
+        CHECK(back == square);
+    }
+    CHECK_THROWS(big_sqrtmod(BigInt("5"), BigInt("1000000007")));
+    CHECK_THROWS(big_sqrtmod(BigInt("4"), BigInt("15")));
+}
+
+TEST_CASE("big_log2 and big_powmod with exponents converted by divide and conquer") {
+    BigInt two("2"), k("3000"), one("1");
+    BigInt power = big_pow(two, k);
+    BigInt below = power - one;
+    BigInt l1 = big_log2(power), l2 = big_log2(below);
+    CHECK(l1 == BigInt("3000"));
+    CHECK(l2 == BigInt("2999"));
+
+    BigInt p("170141183460469231731687303715884105727"), ten("10"), e("500");
+    BigInt exponent = (p - one) * big_pow(ten, e) + BigInt("5");
+    BigInt r = big_powmod(BigInt("3"), exponent, p);
+    CHECK(r == BigInt("243"));
+}
+
+TEST_CASE("to_string, to_chars and big_antilog2") {
+    BigInt a("-1234567890123456789012345678901234567890");
+    CHECK(a.to_string() == "-1234567890123456789012345678901234567890");
+    char buf[64];
+    auto res = a.to_chars(buf, buf + sizeof(buf));
+    CHECK(res.ec == std::errc());
+    CHECK(std::string(buf, res.ptr) == a.to_string());
+    CHECK(a.to_chars(buf, buf + 10).ec == std::errc::value_too_large);
+
+    BigInt k("3000"), two("2");
+    BigInt viaPow = big_pow(two, k), viaBits = big_antilog2(k);
+    CHECK(viaBits == viaPow);
+
+    BigInt big("200000"), modulus("100000000000000000000");
+    BigInt huge = big_antilog2(big);
+    BigInt expected = big_powmod(two, big, modulus), bits = big_log2(huge);
+    std::string digits = huge.to_string();
+    CHECK(digits.length() == 60206);
+    BigInt tail(digits.substr(digits.length() - 20));
+    CHECK(tail == expected);
+    CHECK(bits == big);
+}
+
+TEST_CASE("bigint validation of decimal text") {
+    CHECK_THROWS(BigInt(""));
+    CHECK_THROWS(BigInt("-"));
+    CHECK_THROWS(BigInt("--1"));
+    CHECK_THROWS(BigInt("12a"));
+    CHECK_NOTHROW(BigInt("-0"));
+
+    std::string digits(100, '0');
+    for(size_t i = 0; i < digits.size(); ++i)
+        digits[i] = (char)('0' + (i * 7 + 3) % 10);
+    CHECK_NOTHROW(BigInt{digits});
+    for(size_t pos : {0, 7, 15, 16, 31, 32, 63, 99}) {
+        for(char bad : {'/', ':', ' ', '\x80', '\0'}) {
+            std::string s = digits;
+            s[pos] = bad;
+            CHECK_THROWS(BigInt(s));
+        }
+    }
+
+    BigInt a(digits), b("1");
+    BigInt sum = a + b;
+    std::string expected = digits;
+    expected.back() = (char)(expected.back() + 1);
+    CHECK(sum.to_string() == expected);
+}
+
+TEST_CASE("bigint::to_chars, bigint::from_chars and digits_required") {
+    BigInt a("-255"), b("123456789012345678901234567890");
+    char buf[128];
+    auto r = a.to_chars(buf, buf + sizeof(buf), 16);
+    CHECK(r.ec == std::errc());
+    CHECK(std::string(buf, r.ptr) == "-ff");
+    r = b.to_chars(buf, buf + sizeof(buf), 36);
+    CHECK(std::string(buf, r.ptr) == "byw97um9s91dlz68tsi");
+    CHECK(b.to_chars(buf, buf + 5, 2).ec == std::errc::value_too_large);
+    CHECK(b.to_chars(buf, buf + sizeof(buf), 37).ec == std::errc::invalid_argument);
+    CHECK(b.digits_required() == 30);
+    CHECK(b.digits_required(2) >= 97);
+
+    BigInt v;
+    const char text[] = "-00ZZ!";
+    auto f = BigInt::from_chars(text, text + 6, v, 36);
+    CHECK(f.ec == std::errc());
+    CHECK(f.ptr == text + 5);
+    CHECK(v == BigInt("-1295"));
+
+    const char dec[] = "000123 tail";
+    f = BigInt::from_chars(dec, dec + sizeof(dec) - 1, v);
+    CHECK(f.ptr == dec + 6);
+    CHECK(v == BigInt("123"));
+    const char zero[] = "-0";
+    f = BigInt::from_chars(zero, zero + 2, v);
+    CHECK(v.to_string() == "0");
+
+    BigInt untouched("42");
+    const char junk[] = "-x";
+    f = BigInt::from_chars(junk, junk + 2, untouched);
+    CHECK(f.ec == std::errc::invalid_argument);
+    CHECK(f.ptr == junk);
+    CHECK(untouched == BigInt("42"));
+}
+
+TEST_CASE("bigint in bases 2 to 36 and std::hex streams") {
+    BigInt h("-DeadBeefCafe0123456789", 16), b("1011", 2), z("-0", 8);
+    CHECK(h == BigInt("-269202023516260331422050185"));
+    CHECK(b == BigInt("11"));
+    CHECK(z.to_string() == "0");
+    CHECK_THROWS(BigInt("12g", 16));
+    CHECK_THROWS(BigInt("", 16));
+    CHECK_THROWS(BigInt("11", 37));
+    CHECK(h.to_string(16) == "-deadbeefcafe0123456789");
+    CHECK(h.to_string(32) == "-6ulmvevinu04hkaps9");
+    BigInt big("340282366920938463463374607431768211455");
+    CHECK(big.to_string(2) == std::string(128, '1'));
+    CHECK(big.to_string(8) == "3" + std::string(42, '7'));
+    CHECK(BigInt("0").to_string(16) == "0");
+
+    std::ostringstream out;
+    out << std::hex << big << ' ' << std::showbase << std::uppercase << h << ' ' << std::oct << b;
+    CHECK(out.str() == "ffffffffffffffffffffffffffffffff -0XDEADBEEFCAFE0123456789 013");
+
+    std::istringstream in("0xff -7f zz");
+    BigInt x, y, w("5");
+    in >> std::hex >> x >> y;
+    CHECK(x == BigInt("255"));
+    CHECK(y == BigInt("-127"));
+    in >> w;
+    CHECK(in.fail());
+    CHECK(w == BigInt("5"));
+}
+
+TEST_CASE("bigint::export_bytes, import_bytes and the compact record") {
+    BigInt a("-1311768467463790320");                                   // magnitude 0x123456789abcdef0
+    std::vector<unsigned char> little = a.export_bytes();
+    CHECK(little == std::vector<unsigned char>{0xf0, 0xde, 0xbc, 0x9a, 0x78, 0x56, 0x34, 0x12});
+    std::vector<unsigned char> big = a.export_bytes(BigInt::byteOrder::big, 3);
+    CHECK(big == std::vector<unsigned char>{0x00, 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde, 0xf0});
+    BigInt back = BigInt::import_bytes(big.data(), 3, BigInt::byteOrder::big, 3);
+    CHECK(back == BigInt("1311768467463790320"));
+    CHECK(BigInt("0").export_bytes().empty());
+    CHECK_THROWS(a.export_bytes(BigInt::byteOrder::little, 0));
+
+    BigInt values[] = {BigInt("0"), BigInt("-1"), BigInt("4294967296"), a,
+                       BigInt("-123456789012345678901234567890123456789012345678901234567890")};
+    std::vector<unsigned char> stream;
+    for(BigInt &v : values) {
+        std::vector<unsigned char> record = v.serialize();
+        stream.insert(stream.end(), record.begin(), record.end());
+    }
+    CHECK(BigInt("4294967296").serialize() == std::vector<unsigned char>{0x04, 0, 0, 0, 0, 1, 0, 0, 0});
+    const unsigned char *p = stream.data(), *end = stream.data() + stream.size();
+    for(BigInt &v : values) {
+        BigInt got = BigInt::deserialize(p, end);
+        CHECK(got == v);
+    }
+    CHECK(p == end);
+    const unsigned char truncated[] = {0x04, 0, 0, 0, 0, 1, 0};
+    p = truncated;
+    CHECK_THROWS(BigInt::deserialize(p, truncated + sizeof(truncated)));
+    CHECK(p == truncated);
+}
+
+TEST_CASE("bigint::view and bigint::mappedFile") {
+    std::vector<BigInt> values;
+    BigInt v("-98765432109876543210987654321"), step("123456789123456789");
+    for(int i = 0; i < 50; ++i) {
+        values.push_back(v);
+        v = v * BigInt("-3") + step;
+    }
+    const char *path = "bigint_view_test.bin";
+    {
+        std::ofstream out(path, std::ios::binary);
+        for(BigInt &x : values) {
+            std::vector<unsigned char> record = x.serialize();
+            out.write((const char*)record.data(), record.size());
+        }
+    }
+    {
+        BigInt::mappedFile file(path);
+        BigInt::view first = file.at(0), third = file[2];
+        BigInt copy = third;
+        CHECK(copy == values[2]);
+        CHECK(first.negative());
+        CHECK(third < first);
+        CHECK(file[1] > first);
+        CHECK(first == values[0]);
+        CHECK(third < values[0]);
+        BigInt sum = values[0] + third;
+        CHECK(sum == values[0] + values[2]);
+        CHECK(file.size() == values.size());
+        BigInt last = file[49];
+        CHECK(last == values[49]);
+        CHECK_THROWS_AS(file.at(50), std::out_of_range);
+    }
+    {
+        BigInt::mappedFile shared(path);                // concurrent lookups grow one lazy index
+        std::atomic<int> wrong(0);
+        std::vector<std::thread> readers;
+        for(int t = 0; t < 4; ++t)
+            readers.emplace_back([&, t] {
+                for(int i = 49 - t; i >= 0; i -= 3) {
+                    if(shared.at(i) != values[i])
+                        wrong++;
+                }
+            });
+        for(std::thread &r : readers)
+            r.join();
+        CHECK(wrong == 0);
+    }
+    std::remove(path);
+    CHECK_THROWS(BigInt::mappedFile("no/such/file.bin"));
+}
+
+TEST_CASE("operator>> parses as it reads and reports bad input") {
+    std::istringstream in("  123 -0045\n+7,  -0 000 x9");
+    BigInt a, b, c, d, e, f("11");
+    in >> a >> b >> c;
+    CHECK(a == BigInt("123"));
+    CHECK(b.to_string() == "-45");
+    CHECK(c == BigInt("7"));
+    CHECK(in.peek() == ',');
+    in.ignore();
+    in >> d >> e;
+    CHECK(d.to_string() == "0");
+    CHECK(e.to_string() == "0");
+    in >> f;
+    CHECK(in.fail());
+    CHECK(f == BigInt("11"));
+
+    std::istringstream dash("-");
+    dash >> f;
+    CHECK(dash.fail());
+    CHECK(f == BigInt("11"));
+
+    std::string digits(200000, '9');
+    std::istringstream big(digits);
+    BigInt g;
+    big >> g;
+    CHECK(!big.fail());
+    CHECK(big.eof());
+    CHECK(g.to_string() == digits);
+}
+
+TEST_CASE("three-way compare and const operators") {
+    const BigInt a("-12345678901234567890"), b("-12345678901234567891"), c("00042"), d("42"), z1("-0"), z2("0");
+    CHECK(a.compare(b) == 1);
+    CHECK(b.compare(a) == -1);
+    CHECK(c.compare(d) == 0);
+    CHECK(c == d);
+    CHECK(z1 == z2);
+    CHECK(z1 >= z2);
+    CHECK_FALSE(z1 < z2);
+    CHECK(a < d);
+    CHECK(b <= a);
+    CHECK(d > z1);
+    BigInt sum = a + d, diff = a - b, prod = c * d;
+    CHECK(sum == BigInt("-12345678901234567848"));
+    CHECK(diff == BigInt("1"));
+    CHECK(prod == BigInt("1764"));
+    CHECK(BigInt("00034680273680488234803420283") - BigInt("00034680273680488234803420284") == BigInt("-1"));
+    CHECK(BigInt("-140885") - BigInt("-0140885") == BigInt("0"));
+    CHECK(BigInt("-140885") - BigInt("-0140886") == BigInt("1"));
+    CHECK(BigInt("026115612081") / BigInt("1551304") == BigInt("16834"));
+#ifdef BIGINT_THREE_WAY
+    CHECK((a <=> b) == std::strong_ordering::greater);
+    CHECK((c <=> d) == std::strong_ordering::equal);
+#endif
+
+    std::vector<BigInt> values;
+    for(const char *s : {"5", "-3", "100000000000000000000", "0", "-100000000000000000000", "7"})
+        values.push_back(BigInt(s));
+    std::sort(values.begin(), values.end());
+    std::vector<std::string> sorted;
+    for(const BigInt &v : values)
+        sorted.push_back(v.to_string());
+    CHECK(sorted == std::vector<std::string>{"-100000000000000000000", "-3", "0", "5", "7", "100000000000000000000"});
+}
+
+TEST_CASE("comparisons against primitives and cheap queries") {
+    BigInt zero("-0"), one("0001"), neg("-9223372036854775808"), big("340282366920938463463374607431768211456");
+    CHECK(zero == 0);
+    CHECK(0 == zero);
+    CHECK(one == 1u);
+    CHECK(one != 2L);
+    CHECK(neg == std::numeric_limits<long long>::min());
+    CHECK(neg < 0);
+    CHECK(neg < std::numeric_limits<unsigned long long>::max());
+    CHECK(-5 > neg);
+    unsigned __int128 top = ~(unsigned __int128)0;
+    CHECK(big > top);
+    CHECK(top < big);
+    BigInt topValue = big - BigInt("1");
+    CHECK(topValue == top);
+    CHECK(topValue >= top);
+    __int128 low = -((__int128)1 << 100);
+    CHECK(BigInt("-1267650600228229401496703205376") == low);
+    CHECK(BigInt("-1267650600228229401496703205377") < low);
+    short s = -300;
+    char c = 'A';
+    signed char sc = -1;
+    unsigned short us = 65535;
+    CHECK(s == BigInt("-300"));
+    CHECK(c < BigInt("66"));
+    CHECK(sc > neg);
+    CHECK(us != one);
+    CHECK(one <= us);
+
+    CHECK(zero.is_zero());
+    CHECK(zero.sign() == 0);
+    CHECK(one.is_one());
+    CHECK_FALSE(BigInt("-1").is_one());
+    CHECK(neg.sign() == -1);
+    CHECK(big.sign() == 1);
+    CHECK(big.is_even());
+    CHECK_FALSE(BigInt("-7").is_even());
+}
+
+TEST_CASE("big_sort, big_parallelSort, big_nth_element and big_minmax") {
+    std::vector<BigInt> values;
+    BigInt x("982451653"), m("1000000000000000000000000000057");
+    for(int i = 0; i < 500; ++i) {
+        x = x * BigInt("6364136223846793005") % m;
+        BigInt v = x;
+        if(i % 3 == 0)
+            v = BigInt("0") - x;
+        if(i % 7 == 0)
+            v = BigInt(i % 2 ? "-12" : "0012");
+        values.push_back(v);
+    }
+    std::vector<BigInt> expected = values, sorted = values, parallel = values;
+    std::sort(expected.begin(), expected.end());
+    big_sort(sorted.begin(), sorted.end());
+    big_setThreads(3);
+    big_parallelSort(parallel.begin(), parallel.end());
+    big_setThreads(1);
+    bool same = true;
+    for(size_t i = 0; i < values.size(); ++i)
+        same = same && sorted[i] == expected[i] && parallel[i] == expected[i];
+    CHECK(same);
+
+    std::vector<BigInt> partial = values;
+    big_nth_element(partial.begin(), partial.begin() + 250, partial.end());
+    CHECK(partial[250] == expected[250]);
+    auto range = big_minmax(values.begin(), values.end());
+    CHECK(*range.first == expected.front());
+    CHECK(*range.second == expected.back());
+
+    BigInt a("5"), b("-7");
+    const BigInt &larger = big_max(a, b), &smaller = big_min(a, b);
+    CHECK(&larger == &a);
+    CHECK(&smaller == &b);
+}
+
+TEST_CASE("bitwise operators and shifts") {
+    BigInt a("-123456789012345678901234567890"), b("987654321098765432109876543210");
+    BigInt andv = a & b, orv = a | b, xorv = a ^ b, notv = ~a;
+    CHECK(andv == BigInt("985710360914275162674813760554"));
+    CHECK(orv == BigInt("-121512828827855409466171785234"));
+    CHECK(xorv == BigInt("-1107223189742130572140985545788"));
+    CHECK(notv == BigInt("123456789012345678901234567889"));
+    BigInt masked = b & BigInt("4294967295"), mixed = 255 & BigInt("-256");
+    CHECK(masked == BigInt("3519446762"));
+    CHECK(mixed == 0);
+
+    BigInt left = a << 100, right = b >> 70, negRight = BigInt("-5") >> 1, all = a >> 1000;
+    CHECK(left == BigInt("-156500072693749876333549759454926973536814597484617284976640"));
+    CHECK(right == BigInt("836575750"));
+    CHECK(negRight == BigInt("-3"));
+    CHECK(all == BigInt("-1"));
+    BigInt c("1");
+    c <<= 64;
+    c |= 1;
+    c >>= 1;
+    CHECK(c == BigInt("9223372036854775808"));
+    CHECK_THROWS_AS(a << -1, std::invalid_argument);
+}
+
+TEST_CASE("bit queries") {
+    BigInt a("-123456789012345678901234567890"), b("987654321098765432109876543210"), zero("-0");
+    CHECK(b.bit_length() == 100);
+    CHECK(b.popcount() == 54);
+    CHECK(zero.bit_length() == 0);
+    CHECK(zero.count_trailing_zeros() == BigInt::npos);
+    CHECK(b.count_trailing_zeros() == 1);
+    CHECK(a.count_trailing_zeros() == 1);
+    BigInt power("4820814132776970826625886277023487807566608981348378505904128");   // 3 * 2^200
+    CHECK(power.count_trailing_zeros() == 200);
+
+    CHECK(!b.test_bit(70));
+    CHECK(a.test_bit(3));
+    CHECK(a.test_bit(200));                              // negative values sign extend
+    CHECK(b.scan1(10) == 10);
+    CHECK(a.scan1(2) == 2);
+    CHECK(b.scan1(100) == BigInt::npos);
+
+    BigInt c = b, d = b, e = a, f = a;
+    c.set_bit(130);
+    d.clear_bit(3);
+    e.set_bit(1);
+    f.clear_bit(200);
+    CHECK(c == BigInt("1361129468671408174952263861836949389034"));
+    CHECK(d == BigInt("987654321098765432109876543202"));
+    CHECK(e == a);
+    CHECK(f == BigInt("-1606938044258990275541962092341286059311215339461694069869266"));
+
+    BigInt three("3"), even("8873554201597605810476922437632");      // 7 * 2^100
+    CHECK(big_kronecker(three, even) == -1);
+}
+
+TEST_CASE("floating point and int64 conversions") {
+    BigInt small("-123456789"), exact("9007199254740993"), tie("18347988927920594500282306841763644479275092416506020556053041040394140006252821362754445821584773509808128");
+    CHECK(small.to_double() == -123456789.0);
+    CHECK(exact.to_double() == 9007199254740992.0);      // 2^53 + 1 ties to even
+    CHECK(tie.to_double() == 0x1.0000000000006p+353);    // exactly halfway, decided on the exact bits
+    CHECK(exact.to_long_double() == 9007199254740993.0L);
+    BigInt largest("179769313486231580793728971405303415079934132710037826936173778980444968292764750946649017977587207096330286416692887910946555547851940402630657488671505820681908902000708383676273854845817711531764475730270069855571366959622842914819860834936475292719074168444365510704342711559699508093042880177904174497791");
+    CHECK(largest.to_double() == std::numeric_limits<double>::max());
+    BigInt over = largest + 1, huge(std::string(4000, '9'));
+    CHECK(std::isinf(over.to_double()));
+    CHECK(huge.to_double() == std::numeric_limits<double>::infinity());
+    CHECK(std::isfinite(huge.to_long_double()));
+
+    std::int64_t v = 7;
+    BigInt low("-9223372036854775808"), past("9223372036854775808");
+    CHECK(low.try_to_int64(v));
+    CHECK(v == std::numeric_limits<std::int64_t>::min());
+    CHECK(!past.try_to_int64(v));
+    CHECK(v == std::numeric_limits<std::int64_t>::min());
+
+    BigInt fromDouble(2.5e20), truncated(-0.99), negative(-123456789.75);
+    CHECK(fromDouble == BigInt("250000000000000000000"));
+    CHECK(truncated == 0);
+    CHECK(negative == -123456789);
+    CHECK_THROWS(BigInt(std::numeric_limits<double>::quiet_NaN()));
+}
+
+TEST_CASE("std::hash and fingerprints") {
+    BigInt a("987654321098765432109876543210"), b("-987654321098765432109876543210"), padded("000987654321098765432109876543210");
+    BigInt zero, negativeZero("-0"), mersenne("2305843009213693951");
+    CHECK(a.fingerprint() == 2285054115720104921ull);
+    CHECK(b.fingerprint() == 20788893493589030ull);
+    CHECK(mersenne.fingerprint() == 0);
+    CHECK(padded.hash() == a.hash());
+    CHECK(negativeZero.hash() == zero.hash());
+    CHECK(a.hash() != b.hash());
+    CHECK(std::hash<BigInt>()(a) == a.hash());
+
+    std::unordered_map<BigInt, int> counts;
+    for(int i = 0; i < 1000; ++i)
+        counts[BigInt(std::string(60, '7')) + i % 100]++;
+    counts[padded]++;
+    counts[a]++;
+    CHECK(counts.size() == 101);
+    CHECK(counts[a] == 2);
+
+    std::unordered_set<BigInt::hashKey> keys;
+    keys.insert(a);
+    keys.insert(padded);
+    keys.insert(b);
+    CHECK(keys.size() == 2);
+    CHECK(keys.count(BigInt("987654321098765432109876543210")) == 1);
+    CHECK(keys.find(b)->fingerprint() == b.fingerprint());
+}